@@ -63,6 +63,8 @@ void AudioMixer::Close()
     _convertBuffer.shrink_to_fit();
     _effectBuffer.clear();
     _effectBuffer.shrink_to_fit();
+    _mixBuffer.clear();
+    _mixBuffer.shrink_to_fit();
 }
 
 void AudioMixer::Lock()
@@ -128,8 +130,16 @@ void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
 {
     UpdateAdjustedSound();
 
-    // Zero the output buffer
-    std::fill_n(dst, length, 0);
+    // Zero the output buffer, or the float mix bus when channels are mixed through it
+    const bool useMixBus = UseMixBus();
+    if (useMixBus)
+    {
+        _mixBuffer.assign(length / sizeof(int16_t), 0.0f);
+    }
+    else
+    {
+        std::fill_n(dst, length, 0);
+    }
 
     // Mix channels onto output buffer
     auto it = _channels.begin();
@@ -154,6 +164,16 @@ void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
             it++;
         }
     }
+
+    if (useMixBus)
+    {
+        ResolveS16(reinterpret_cast<int16_t*>(dst), _mixBuffer.data(), static_cast<int32_t>(_mixBuffer.size()));
+    }
+}
+
+bool AudioMixer::UseMixBus() const
+{
+    return _format.format == AUDIO_S16SYS && _format.channels == 2;
 }
 
 void AudioMixer::UpdateAdjustedSound()
@@ -240,6 +260,19 @@ void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t len
         buffer = _effectBuffer.data();
     }
 
+    if (UseMixBus())
+    {
+        // Pan, volume and fade are applied in one pass while mixing onto the float bus
+        auto frames = static_cast<int32_t>(std::min(length, bufferLen) / byteRate);
+        if (frames > 0)
+        {
+            auto ramp = GetMixRamp(channel, frames);
+            MixS16Stereo(_mixBuffer.data(), static_cast<const int16_t*>(buffer), frames, ramp);
+        }
+        channel->UpdateOldVolume();
+        return;
+    }
+
     // Apply panning and volume
     ApplyPan(channel, buffer, bufferLen, byteRate);
     int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
@@ -294,7 +327,31 @@ void AudioMixer::ApplyPan(const IAudioChannel* channel, void* buffer, size_t len
     }
 }
 
-int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+MixRamp AudioMixer::GetMixRamp(const IAudioChannel* channel, int32_t frames) const
+{
+    MixRamp ramp;
+    if (channel->GetPan() != 0.5f)
+    {
+        ramp.PanL = channel->GetOldVolumeL();
+        ramp.PanR = channel->GetOldVolumeR();
+        ramp.PanStepL = (channel->GetVolumeL() - ramp.PanL) / frames;
+        ramp.PanStepR = (channel->GetVolumeR() - ramp.PanR) / frames;
+    }
+
+    float volumeAdjust = GetVolumeAdjust(channel);
+    int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
+    int32_t endVolume = channel->GetVolume() * volumeAdjust;
+    if (channel->IsStopping())
+    {
+        endVolume = 0;
+    }
+
+    ramp.Volume = static_cast<float>(startVolume) / kMixerVolumeMax;
+    ramp.VolumeStep = static_cast<float>(endVolume - startVolume) / kMixerVolumeMax / frames;
+    return ramp;
+}
+
+float AudioMixer::GetVolumeAdjust(const IAudioChannel* channel) const
 {
     float volumeAdjust = _volume;
     volumeAdjust *= Config::Get().sound.MasterSoundEnabled ? (static_cast<float>(Config::Get().sound.MasterVolume) / 100.0f)
@@ -316,7 +373,12 @@ int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size
             volumeAdjust *= _adjustMusicVolume;
             break;
     }
+    return volumeAdjust;
+}
 
+int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+{
+    float volumeAdjust = GetVolumeAdjust(channel);
     int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
     int32_t endVolume = channel->GetVolume() * volumeAdjust;
     if (channel->IsStopping())
@@ -21,6 +21,7 @@
 #include <openrct2/Context.h>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioMixer.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/audio/audio.h>
 #include <vector>
@@ -44,6 +45,7 @@ namespace OpenRCT2::Audio
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
         std::vector<uint8_t> _effectBuffer;
+        std::vector<float> _mixBuffer;
 
         std::mutex _mutex;
 
@@ -62,6 +64,7 @@ namespace OpenRCT2::Audio
     private:
         void GetNextAudioChunk(uint8_t* dst, size_t length);
         void UpdateAdjustedSound();
+        bool UseMixBus() const;
         void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length);
         void RemoveReleasedSources();
 
@@ -72,6 +75,8 @@ namespace OpenRCT2::Audio
         size_t ApplyResample(
             ISDLAudioChannel* channel, const void* srcBuffer, int32_t srcSamples, int32_t dstSamples, int32_t inRate,
             int32_t outRate);
+        MixRamp GetMixRamp(const IAudioChannel* channel, int32_t frames) const;
+        float GetVolumeAdjust(const IAudioChannel* channel) const;
         void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize);
         int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len);
         static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length);
@@ -380,6 +380,12 @@ public:
         _drawingContext->GetTextureCache()->InvalidateImage(image);
     }
 
+    DirtyRegionStats GetDirtyRegionStats() override
+    {
+        // The whole screen is redrawn every frame
+        return {};
+    }
+
     DrawPixelInfo* GetDPI()
     {
         return &_bitsDPI;
@@ -725,11 +725,12 @@ namespace OpenRCT2::Ui
         int32_t distance = std::numeric_limits<decltype(distance)>::max();
     };
 
-    template<typename T>
+    template<typename T, typename TList>
     static PeepDistance GetClosestPeep(
-        const ScreenCoordsXY& viewportCoords, uint8_t rotation, const int32_t maxDistance, PeepDistance goal)
+        TList&& peeps, const ScreenCoordsXY& viewportCoords, uint8_t rotation, const int32_t maxDistance,
+        PeepDistance goal)
     {
-        for (auto peep : EntityList<T>())
+        for (auto peep : peeps)
         {
             if (peep->x == kLocationNull)
                 continue;
@@ -753,6 +754,22 @@ namespace OpenRCT2::Ui
         return goal;
     }
 
+    template<typename T>
+    static PeepDistance GetClosestPeep(
+        const ScreenCoordsXY& viewportCoords, uint8_t rotation, const int32_t maxDistance, PeepDistance goal)
+    {
+        // The screen index is rebuilt for each new rotation it is asked for, so viewports rotated apart from the main
+        // one still look through every peep
+        if (rotation == GetCurrentRotation())
+        {
+            const ScreenRect searchRect = { viewportCoords - ScreenCoordsXY{ maxDistance, maxDistance },
+                                            viewportCoords + ScreenCoordsXY{ maxDistance, maxDistance } };
+            return GetClosestPeep<T>(
+                EntityScreenList<T>(searchRect, rotation), viewportCoords, rotation, maxDistance, goal);
+        }
+        return GetClosestPeep<T>(EntityList<T>(), viewportCoords, rotation, maxDistance, goal);
+    }
+
     static Peep* ViewportInteractionGetClosestPeep(ScreenCoordsXY screenCoords, int32_t maxDistance)
     {
         auto* w = WindowFindFromPoint(screenCoords);
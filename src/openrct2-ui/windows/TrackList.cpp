@@ -21,9 +21,11 @@
 #include <openrct2/ride/RideConstruction.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
+#include <unordered_set>
 #include <vector>
 
 namespace OpenRCT2::Ui::Windows
@@ -78,6 +80,7 @@ namespace OpenRCT2::Ui::Windows
         uint16_t _loadedTrackDesignIndex;
         std::unique_ptr<TrackDesign> _loadedTrackDesign;
         std::vector<uint8_t> _trackDesignPreviewPixels;
+        std::unordered_set<uint16_t> _cachedTrackDesignIds;
         bool _selectedItemIsBeingUpdated;
         bool _reloadTrackDesigns;
 
@@ -191,6 +194,7 @@ namespace OpenRCT2::Ui::Windows
                 }
             }
             _trackDesigns = repo->GetItemsForObjectEntry(item.Type, entryName);
+            _cachedTrackDesignIds.clear();
 
             FilterList();
         }
@@ -200,12 +204,49 @@ namespace OpenRCT2::Ui::Windows
             _loadedTrackDesign = TrackDesignImport(path.c_str());
             if (_loadedTrackDesign != nullptr)
             {
-                TrackDesignDrawPreview(*_loadedTrackDesign, _trackDesignPreviewPixels.data());
+                TrackDesignDrawPreviewCached(*_loadedTrackDesign, path, _trackDesignPreviewPixels.data());
                 return true;
             }
             return false;
         }
 
+        /**
+         * Draws the previews of the designs either side of the selected one into the preview cache, at most one per update,
+         * so that moving on to them does not have to wait for the drawing. This has to happen on the main thread as the
+         * previews are drawn by placing the design on the game map, which would hold up a running game, so it is only
+         * done in the track manager.
+         */
+        void CacheNeighbouringPreview()
+        {
+            if ((gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) == 0)
+                return;
+
+            // Wait until the selected design itself has been drawn
+            const int32_t listItemIndex = selected_list_item;
+            if (listItemIndex < 0 || static_cast<size_t>(listItemIndex) >= _filteredTrackIds.size()
+                || _filteredTrackIds[listItemIndex] != _loadedTrackDesignIndex)
+                return;
+
+            for (auto neighbourIndex : { listItemIndex + 1, listItemIndex - 1 })
+            {
+                if (neighbourIndex < 0 || static_cast<size_t>(neighbourIndex) >= _filteredTrackIds.size())
+                    continue;
+
+                const auto trackIndex = _filteredTrackIds[neighbourIndex];
+                if (!_cachedTrackDesignIds.insert(trackIndex).second)
+                    continue;
+
+                const auto& path = _trackDesigns[trackIndex].path;
+                auto trackDesign = TrackDesignImport(path.c_str());
+                if (trackDesign != nullptr)
+                {
+                    std::vector<uint8_t> pixels(4 * kTrackPreviewImageSize);
+                    TrackDesignDrawPreviewCached(*trackDesign, path, pixels.data());
+                }
+                return;
+            }
+        }
+
     public:
         TrackListWindow(const RideSelection item)
         {
@@ -253,6 +294,7 @@ namespace OpenRCT2::Ui::Windows
             _loadedTrackDesign = nullptr;
             _trackDesignPreviewPixels.clear();
             _trackDesignPreviewPixels.shrink_to_fit();
+            TrackDesignPreviewCache::ClearMemory();
 
             // Dispose track list
             _trackDesigns.clear();
@@ -285,6 +327,7 @@ namespace OpenRCT2::Ui::Windows
                 case WIDX_TOGGLE_SCENERY:
                     gTrackDesignSceneryToggle = !gTrackDesignSceneryToggle;
                     _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
+                    _cachedTrackDesignIds.clear();
                     Invalidate();
                     break;
                 case WIDX_BACK:
@@ -445,6 +488,10 @@ namespace OpenRCT2::Ui::Windows
                 Invalidate();
                 _reloadTrackDesigns = false;
             }
+            else
+            {
+                CacheNeighbouringPreview();
+            }
         }
 
         void OnDraw(DrawPixelInfo& dpi) override
@@ -160,7 +160,9 @@ public:
 void AssetPack::Load()
 {
     auto path = Path.u8string();
-    auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+
+    // Shared, as the samples read from the pack afterwards open it again
+    auto archive = Zip::OpenShared(path);
     if (!archive->Exists(ManifestFileName))
     {
         throw std::runtime_error("Manifest does not exist.");
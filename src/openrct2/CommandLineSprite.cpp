@@ -14,6 +14,7 @@
 #include "OpenRCT2.h"
 #include "core/FileStream.h"
 #include "core/Imaging.h"
+#include "core/JobPool.h"
 #include "core/Json.hpp"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -24,9 +25,12 @@
 #include "object/ObjectRepository.h"
 #include "util/Util.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <optional>
+#include <unordered_map>
 
 // TODO: Remove when C++20 is enabled and std::format can be used
 #include <iomanip>
@@ -227,19 +231,29 @@ static bool SpriteImageExport(const G1Element& spriteElement, u8string_view outP
     }
 }
 
-static std::optional<ImageImporter::ImportResult> SpriteImageImport(u8string_view path, ImageImportMeta meta)
+static IMAGE_FORMAT SpriteImageGetFormat(const ImageImportMeta& meta)
+{
+    return meta.palette == Palette::KeepIndices ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
+}
+
+static std::optional<Image> SpriteImageRead(u8string_view path, IMAGE_FORMAT format)
 {
     try
     {
-        auto format = IMAGE_FORMAT::PNG_32;
-        if (meta.palette == Palette::KeepIndices)
-        {
-            format = IMAGE_FORMAT::PNG;
-        }
+        return Imaging::ReadFromFile(path, format);
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "%s\n", e.what());
+        return std::nullopt;
+    }
+}
 
+static std::optional<ImageImporter::ImportResult> SpriteImageImport(const Image& image, ImageImportMeta meta)
+{
+    try
+    {
         ImageImporter importer;
-        auto image = Imaging::ReadFromFile(path, format);
-
         return importer.Import(image, meta);
     }
     catch (const std::exception& e)
@@ -249,6 +263,16 @@ static std::optional<ImageImporter::ImportResult> SpriteImageImport(u8string_vie
     }
 }
 
+static std::optional<ImageImporter::ImportResult> SpriteImageImport(u8string_view path, ImageImportMeta meta)
+{
+    auto image = SpriteImageRead(path, SpriteImageGetFormat(meta));
+    if (!image.has_value())
+    {
+        return std::nullopt;
+    }
+    return SpriteImageImport(image.value(), meta);
+}
+
 // TODO: Remove when C++20 is enabled and std::format can be used
 static std::string PopStr(std::ostringstream& oss)
 {
@@ -554,7 +578,27 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
 
         fprintf(stdout, "Building: %s\n", spriteFilePath);
 
-        json_t sprite_description;
+        struct SpriteSource
+        {
+            std::string Path;
+            IMAGE_FORMAT Format{};
+            std::optional<Image> Decoded;
+            size_t NumSprites{};
+        };
+
+        struct SpriteToBuild
+        {
+            std::string Path;
+            ImageImportMeta Meta;
+            size_t SourceIndex{};
+            std::optional<ImageImporter::ImportResult> Result;
+        };
+
+        // Sprites are often cut from a few large sheets, so every sheet is only read once. A sheet is read in the
+        // format of the sprites cut from it, so there can be one source per format with the same path.
+        std::vector<SpriteSource> sources;
+        std::unordered_map<std::string, std::vector<size_t>> sourcesByPath;
+        std::vector<SpriteToBuild> sprites;
 
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
@@ -577,18 +621,73 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
             meta.importMode = gSpriteMode;
 
             auto imagePath = Path::GetAbsolute(Path::Combine(directoryPath, strPath));
+            auto format = SpriteImageGetFormat(meta);
+
+            auto& pathSources = sourcesByPath[imagePath];
+            auto itSource = std::find_if(pathSources.begin(), pathSources.end(), [&](size_t index) {
+                return sources[index].Format == format;
+            });
+            size_t sourceIndex;
+            if (itSource != pathSources.end())
+            {
+                sourceIndex = *itSource;
+            }
+            else
+            {
+                sourceIndex = sources.size();
+                sources.push_back({ imagePath, format, std::nullopt });
+                pathSources.push_back(sourceIndex);
+            }
+            sources[sourceIndex].NumSprites++;
+            sprites.push_back({ std::move(imagePath), meta, sourceIndex, std::nullopt });
+        }
+
+        // Read the sheets and then convert the sprites on all cores, the sprites are still added in order
+        {
+            JobPool jobs{};
+            for (auto& source : sources)
+            {
+                jobs.AddTask([&source]() { source.Decoded = SpriteImageRead(source.Path, source.Format); });
+            }
+            jobs.Join();
+
+            // Each sheet is released as soon as the last sprite cut from it is imported
+            std::vector<std::atomic<size_t>> spritesLeft(sources.size());
+            for (size_t i = 0; i < sources.size(); i++)
+            {
+                spritesLeft[i] = sources[i].NumSprites;
+            }
 
-            auto importResult = SpriteImageImport(imagePath, meta);
-            if (importResult == std::nullopt)
+            for (auto& sprite : sprites)
+            {
+                auto& source = sources[sprite.SourceIndex];
+                if (source.Decoded.has_value())
+                {
+                    auto& sourceSpritesLeft = spritesLeft[sprite.SourceIndex];
+                    jobs.AddTask([&sprite, &source, &sourceSpritesLeft]() {
+                        sprite.Result = SpriteImageImport(source.Decoded.value(), sprite.Meta);
+                        if (--sourceSpritesLeft == 0)
+                        {
+                            source.Decoded.reset();
+                        }
+                    });
+                }
+            }
+            jobs.Join();
+        }
+
+        for (auto& sprite : sprites)
+        {
+            if (sprite.Result == std::nullopt)
             {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
+                fprintf(stderr, "Could not import image file: %s\nCanceling\n", sprite.Path.c_str());
                 return -1;
             }
 
-            spriteFile.AddImage(importResult.value());
+            spriteFile.AddImage(sprite.Result.value());
 
             if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
+                fprintf(stdout, "Added: %s\n", sprite.Path.c_str());
         }
 
         if (!spriteFile.Save(spriteFilePath))
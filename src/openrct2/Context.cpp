@@ -34,6 +34,7 @@
 #include "core/FileStream.h"
 #include "core/Guard.hpp"
 #include "core/Http.h"
+#include "core/JobPool.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -83,7 +84,9 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -161,6 +164,8 @@ namespace OpenRCT2
         // We keep track of this to perform certain operations differently.
         std::thread::id _mainThreadId{};
         Timer _forcedUpdateTimer;
+        // Startup stages running side by side can report progress at the same time
+        std::mutex _progressMutex;
 
     public:
         // Singleton of Context.
@@ -547,6 +552,88 @@ namespace OpenRCT2
         }
 
     private:
+        struct StartupStage
+        {
+            const char* Name;
+            StringId Caption;
+            std::vector<size_t> DependsOn;
+            std::function<void()> Run;
+        };
+
+        /**
+         * Runs the stages on a worker pool, each one as soon as the stages it depends on have finished, and logs how
+         * long each of them took. The first exception thrown by a stage is rethrown once all started stages are done.
+         */
+        void RunStartupStages(const std::vector<StartupStage>& stages, size_t maxThreads)
+        {
+            Timer totalTimer;
+            std::vector<size_t> remainingDependencies(stages.size());
+            std::vector<std::vector<size_t>> dependants(stages.size());
+            std::vector<float> durations(stages.size());
+            std::vector<std::exception_ptr> errors(stages.size());
+            std::exception_ptr firstError;
+            for (size_t i = 0; i < stages.size(); i++)
+            {
+                remainingDependencies[i] = stages[i].DependsOn.size();
+                for (auto dependency : stages[i].DependsOn)
+                {
+                    dependants[dependency].push_back(i);
+                }
+            }
+
+            // Completion callbacks run on this thread from within Join, so the bookkeeping needs no locking
+            JobPool jobPool(maxThreads);
+            std::function<void(size_t)> startStage = [&](size_t index) {
+                jobPool.AddTask(
+                    [&, index]() {
+                        const auto& stage = stages[index];
+                        OpenProgress(stage.Caption);
+                        Timer stageTimer;
+                        try
+                        {
+                            stage.Run();
+                        }
+                        catch (...)
+                        {
+                            errors[index] = std::current_exception();
+                        }
+                        durations[index] = stageTimer.GetElapsedTime().count();
+                    },
+                    [&, index]() {
+                        LOG_VERBOSE("Startup stage '%s' took %.3f seconds", stages[index].Name, durations[index]);
+                        if (errors[index] != nullptr)
+                        {
+                            // Stages depending on a failed one are not started
+                            if (firstError == nullptr)
+                                firstError = errors[index];
+                            return;
+                        }
+                        for (auto dependant : dependants[index])
+                        {
+                            if (--remainingDependencies[dependant] == 0)
+                            {
+                                startStage(dependant);
+                            }
+                        }
+                    });
+            };
+
+            for (size_t i = 0; i < stages.size(); i++)
+            {
+                if (remainingDependencies[i] == 0)
+                {
+                    startStage(i);
+                }
+            }
+            jobPool.Join();
+
+            LOG_VERBOSE("Startup stages finished in %.3f seconds", totalTimer.GetElapsedTime().count());
+            if (firstError != nullptr)
+            {
+                std::rethrow_exception(firstError);
+            }
+        }
+
         void InitialiseRepositories()
         {
             if (!_initialised)
@@ -556,28 +643,39 @@ namespace OpenRCT2
 
             auto currentLanguage = _localisationService->GetCurrentLanguage();
 
-            OpenProgress(STR_CHECKING_OBJECT_FILES);
-            _objectRepository->LoadOrConstruct(currentLanguage);
-
-            OpenProgress(STR_LOADING_GENERIC);
-            Audio::LoadAudioObjects();
-
+            // Track designs and scenarios look up the objects they use while being indexed, the audio objects are
+            // loaded from the object repository and asset packs reload the audio objects. Title sequences stand alone.
+            enum : size_t
+            {
+                kStageObjects,
+                kStageAudioObjects,
+                kStageTrackDesigns,
+                kStageScenarios,
+                kStageTitleSequences,
+                kStageAssetPacks,
+            };
+            std::vector<StartupStage> stages = {
+                { "objects", STR_CHECKING_OBJECT_FILES, {},
+                  [&]() { _objectRepository->LoadOrConstruct(currentLanguage); } },
+                { "audio objects", STR_LOADING_GENERIC, { kStageObjects }, []() { Audio::LoadAudioObjects(); } },
+                { "track designs", STR_CHECKING_TRACK_DESIGN_FILES, { kStageObjects },
+                  [&]() { _trackDesignRepository->Scan(currentLanguage); } },
+                { "scenarios", STR_CHECKING_SCENARIO_FILES, { kStageObjects },
+                  [&]() { _scenarioRepository->Scan(currentLanguage); } },
+                { "title sequences", STR_CHECKING_TITLE_SEQUENCES, {}, []() { TitleSequenceManager::Scan(); } },
+            };
             if (!gOpenRCT2Headless)
             {
-                OpenProgress(STR_CHECKING_ASSET_PACKS);
-                _assetPackManager->Scan();
-                _assetPackManager->LoadEnabledAssetPacks();
-                _assetPackManager->Reload();
+                stages.push_back({ "asset packs", STR_CHECKING_ASSET_PACKS, { kStageAudioObjects }, [this]() {
+                                      _assetPackManager->Scan();
+                                      _assetPackManager->LoadEnabledAssetPacks();
+                                      _assetPackManager->Reload();
+                                  } });
             }
 
-            OpenProgress(STR_CHECKING_TRACK_DESIGN_FILES);
-            _trackDesignRepository->Scan(currentLanguage);
-
-            OpenProgress(STR_CHECKING_SCENARIO_FILES);
-            _scenarioRepository->Scan(currentLanguage);
-
-            OpenProgress(STR_CHECKING_TITLE_SEQUENCES);
-            TitleSequenceManager::Scan();
+            // With a user interface the stages run one at a time so that the progress window shows one caption at a
+            // time and is only ever updated from the preloader thread.
+            RunStartupStages(stages, gOpenRCT2Headless ? std::max(1u, std::thread::hardware_concurrency()) : 1);
 
             OpenProgress(STR_LOADING_GENERIC);
         }
@@ -661,6 +759,7 @@ namespace OpenRCT2
 
         void OpenProgress(StringId captionStringId) override
         {
+            std::lock_guard lock(_progressMutex);
             auto captionString = _localisationService->GetString(captionStringId);
             auto intent = Intent(INTENT_ACTION_PROGRESS_OPEN);
             intent.PutExtra(INTENT_EXTRA_MESSAGE, captionString);
@@ -669,6 +768,7 @@ namespace OpenRCT2
 
         void SetProgress(uint32_t currentProgress, uint32_t totalCount, StringId format = STR_NONE) override
         {
+            std::lock_guard lock(_progressMutex);
             if (_forcedUpdateTimer.GetElapsedTime() < kForcedUpdateInterval)
                 return;
 
@@ -18,6 +18,7 @@
 #include "../drawing/Drawing.h"
 #include "../entity/Duck.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestStatistics.h"
 #include "../entity/Staff.h"
 #include "../localisation/StringIds.h"
 #include "../network/network.h"
@@ -644,6 +645,7 @@ void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
                     peep->PeepFlags &= ~PEEP_FLAGS_ANGRY;
                     peep->Angriness = 0;
                 }
+                GuestStatistics::UpdateGuest(*peep);
                 break;
             case GUEST_PARAMETER_ENERGY:
                 peep->Energy = value;
@@ -17,6 +17,7 @@
 #include "../management/Finance.h"
 #include "../world/Location.hpp"
 #include "../world/Map.h"
+#include "../world/TileElementsView.h"
 #include "FootpathRemoveAction.h"
 #include "LargeSceneryRemoveAction.h"
 #include "SmallSceneryRemoveAction.h"
@@ -123,6 +124,13 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
     // Pass down all flags.
     TileElement* tileElement = nullptr;
     money64 totalCost = 0;
+
+    constexpr TileElementTypeMask kClearableTypes = TileElementTypeBit(TileElementType::Path)
+        | TileElementTypeBit(TileElementType::SmallScenery) | TileElementTypeBit(TileElementType::Wall)
+        | TileElementTypeBit(TileElementType::LargeScenery);
+    if (!(MapGetTileElementTypes(TileCoordsXY(tilePos)) & kClearableTypes))
+        return totalCost;
+
     bool tileEdited;
     do
     {
@@ -218,23 +226,9 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
 void ClearAction::ResetClearLargeSceneryFlag()
 {
     auto& gameState = GetGameState();
-    // TODO: Improve efficiency of this
-    for (int32_t y = 0; y < gameState.MapSize.y; y++)
-    {
-        for (int32_t x = 0; x < gameState.MapSize.x; x++)
-        {
-            auto tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
-            do
-            {
-                if (tileElement == nullptr)
-                    break;
-                if (tileElement->GetType() == TileElementType::LargeScenery)
-                {
-                    tileElement->AsLargeScenery()->SetIsAccounted(false);
-                }
-            } while (!(tileElement++)->IsLastForTile());
-        }
-    }
+    ForEachTileElementInRange<LargeSceneryElement>(
+        { 0, 0 }, { gameState.MapSize.x - 1, gameState.MapSize.y - 1 },
+        [](const TileCoordsXY&, LargeSceneryElement* largeScenery) { largeScenery->SetIsAccounted(false); });
 }
 
 bool ClearAction::MapCanClearAt(const CoordsXY& location)
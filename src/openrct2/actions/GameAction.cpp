@@ -27,6 +27,7 @@
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 
@@ -357,6 +358,12 @@ namespace OpenRCT2::GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            // Actions such as the tile inspector edit elements in place. Ghost previews are placed and removed every
+            // tick while building, they only touch ghost elements so leave caches derived from the map alone.
+            if (!(flags & GAME_COMMAND_FLAG_GHOST))
+            {
+                MapIncrementTileElementsRevision();
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
@@ -13,6 +13,7 @@
 #include "../Diagnostic.h"
 #include "../OpenRCT2.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestStatistics.h"
 
 using namespace OpenRCT2;
 
@@ -61,6 +62,7 @@ GameActions::Result GuestSetFlagsAction::Execute() const
     }
 
     peep->PeepFlags = _newFlags;
+    GuestStatistics::UpdateGuest(*peep);
 
     return GameActions::Result();
 }
@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Guard.hpp"
+#include "AudioMixing.h"
+
+#ifdef __AVX2__
+
+#    include <immintrin.h>
+
+namespace OpenRCT2::Audio
+{
+    void MixS16StereoAvx2(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        // Four stereo frames per vector, laid out as L R L R L R L R
+        const __m256 panBase = _mm256_setr_ps(
+            ramp.PanL, ramp.PanR, ramp.PanL, ramp.PanR, ramp.PanL, ramp.PanR, ramp.PanL, ramp.PanR);
+        const __m256 panStep = _mm256_setr_ps(
+            ramp.PanStepL, ramp.PanStepR, ramp.PanStepL, ramp.PanStepR, ramp.PanStepL, ramp.PanStepR, ramp.PanStepL,
+            ramp.PanStepR);
+        const __m256 volumeBase = _mm256_set1_ps(ramp.Volume);
+        const __m256 volumeStep = _mm256_set1_ps(ramp.VolumeStep);
+        const __m256i frameStep = _mm256_set1_epi32(4);
+        __m256i frameIndex = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+
+        int32_t i = 0;
+        for (; i + 4 <= frames; i += 4)
+        {
+            const __m256 t = _mm256_cvtepi32_ps(frameIndex);
+            const __m256 volume = _mm256_add_ps(volumeBase, _mm256_mul_ps(t, volumeStep));
+            const __m256 gain = _mm256_mul_ps(_mm256_add_ps(panBase, _mm256_mul_ps(t, panStep)), volume);
+
+            const __m128i samples16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+            const __m256 samples = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(samples16));
+            const __m256 mixed = _mm256_add_ps(_mm256_loadu_ps(dst + i * 2), _mm256_mul_ps(samples, gain));
+            _mm256_storeu_ps(dst + i * 2, mixed);
+
+            frameIndex = _mm256_add_epi32(frameIndex, frameStep);
+        }
+        MixS16StereoRange(dst, src, i, frames, ramp);
+    }
+
+    void ResolveS16Avx2(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        const __m256 lower = _mm256_set1_ps(-32768.0f);
+        const __m256 upper = _mm256_set1_ps(32767.0f);
+
+        int32_t i = 0;
+        for (; i + 16 <= samples; i += 16)
+        {
+            const __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), lower), upper);
+            const __m256 b = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i + 8), lower), upper);
+            // Packing works per 128-bit lane, so restore the sample order afterwards
+            const __m256i packed = _mm256_packs_epi32(_mm256_cvttps_epi32(a), _mm256_cvttps_epi32(b));
+            const __m256i ordered = _mm256_permute4x64_epi64(packed, 0b11011000);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ordered);
+        }
+        ResolveS16Scalar(dst + i, src + i, samples - i);
+    }
+} // namespace OpenRCT2::Audio
+
+#else
+
+#    ifdef OPENRCT2_X86
+#        error You have to compile this file with AVX2 enabled, when targeting x86!
+#    endif
+
+namespace OpenRCT2::Audio
+{
+    void MixS16StereoAvx2(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+    }
+
+    void ResolveS16Avx2(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+    }
+} // namespace OpenRCT2::Audio
+
+#endif // __AVX2__
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include "../Diagnostic.h"
+#include "../platform/Platform.h"
+
+#include <algorithm>
+
+namespace OpenRCT2::Audio
+{
+    void MixS16StereoRange(
+        float* RESTRICT dst, const int16_t* RESTRICT src, int32_t begin, int32_t end, const MixRamp& ramp)
+    {
+        for (int32_t i = begin; i < end; i++)
+        {
+            const auto t = static_cast<float>(i);
+            const float volume = ramp.Volume + t * ramp.VolumeStep;
+            const float gainL = (ramp.PanL + t * ramp.PanStepL) * volume;
+            const float gainR = (ramp.PanR + t * ramp.PanStepR) * volume;
+            dst[i * 2 + 0] += static_cast<float>(src[i * 2 + 0]) * gainL;
+            dst[i * 2 + 1] += static_cast<float>(src[i * 2 + 1]) * gainR;
+        }
+    }
+
+    void MixS16StereoScalar(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        MixS16StereoRange(dst, src, 0, frames, ramp);
+    }
+
+    void ResolveS16Scalar(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        for (int32_t i = 0; i < samples; i++)
+        {
+            dst[i] = static_cast<int16_t>(std::clamp(src[i], -32768.0f, 32767.0f));
+        }
+    }
+
+    static auto GetMixFunction()
+    {
+        if (Platform::AVX2Available())
+        {
+            LOG_VERBOSE("registering AVX2 mix function");
+            return MixS16StereoAvx2;
+        }
+        else if (Platform::SSE41Available())
+        {
+            LOG_VERBOSE("registering SSE4.1 mix function");
+            return MixS16StereoSse4_1;
+        }
+        else
+        {
+            LOG_VERBOSE("registering scalar mix function");
+            return MixS16StereoScalar;
+        }
+    }
+
+    static auto GetResolveFunction()
+    {
+        if (Platform::AVX2Available())
+        {
+            return ResolveS16Avx2;
+        }
+        else if (Platform::SSE41Available())
+        {
+            return ResolveS16Sse4_1;
+        }
+        else
+        {
+            return ResolveS16Scalar;
+        }
+    }
+
+    static const auto MixFunc = GetMixFunction();
+    static const auto ResolveFunc = GetResolveFunction();
+
+    void MixS16Stereo(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        MixFunc(dst, src, frames, ramp);
+    }
+
+    void ResolveS16(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        ResolveFunc(dst, src, samples);
+    }
+} // namespace OpenRCT2::Audio
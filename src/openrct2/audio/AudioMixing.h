@@ -0,0 +1,53 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/CallingConventions.h"
+
+#include <cstdint>
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * Gain ramp applied to a channel while it is mixed onto the float bus. The gain of frame i is
+     * (Pan + i * PanStep) * (Volume + i * VolumeStep), which fuses panning, volume and fading into one pass.
+     */
+    struct MixRamp
+    {
+        float PanL = 1.0f;
+        float PanR = 1.0f;
+        float PanStepL = 0.0f;
+        float PanStepR = 0.0f;
+        float Volume = 1.0f;
+        float VolumeStep = 0.0f;
+    };
+
+    /**
+     * Adds interleaved signed 16-bit stereo frames [begin, end) onto the float mix bus.
+     * Used by the vectorised kernels to mix whatever is left after their last full vector.
+     */
+    void MixS16StereoRange(
+        float* RESTRICT dst, const int16_t* RESTRICT src, int32_t begin, int32_t end, const MixRamp& ramp);
+
+    void MixS16StereoScalar(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp);
+    void MixS16StereoSse4_1(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp);
+    void MixS16StereoAvx2(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp);
+
+    /**
+     * Clamps the float mix bus into signed 16-bit samples, truncating towards zero.
+     */
+    void ResolveS16Scalar(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples);
+    void ResolveS16Sse4_1(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples);
+    void ResolveS16Avx2(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples);
+
+    // Dispatch to the best kernel available on this CPU.
+    void MixS16Stereo(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp);
+    void ResolveS16(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Guard.hpp"
+#include "AudioMixing.h"
+
+#ifdef __SSE4_1__
+
+#    include <immintrin.h>
+
+namespace OpenRCT2::Audio
+{
+    void MixS16StereoSse4_1(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        // Two stereo frames per vector, laid out as L R L R
+        const __m128 panBase = _mm_setr_ps(ramp.PanL, ramp.PanR, ramp.PanL, ramp.PanR);
+        const __m128 panStep = _mm_setr_ps(ramp.PanStepL, ramp.PanStepR, ramp.PanStepL, ramp.PanStepR);
+        const __m128 volumeBase = _mm_set1_ps(ramp.Volume);
+        const __m128 volumeStep = _mm_set1_ps(ramp.VolumeStep);
+        const __m128i frameStep = _mm_set1_epi32(2);
+        __m128i frameIndex = _mm_setr_epi32(0, 0, 1, 1);
+
+        int32_t i = 0;
+        for (; i + 2 <= frames; i += 2)
+        {
+            const __m128 t = _mm_cvtepi32_ps(frameIndex);
+            const __m128 volume = _mm_add_ps(volumeBase, _mm_mul_ps(t, volumeStep));
+            const __m128 gain = _mm_mul_ps(_mm_add_ps(panBase, _mm_mul_ps(t, panStep)), volume);
+
+            // _mm_cvtepi16_epi32 is SSE4.1
+            const __m128i samples16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 2));
+            const __m128 samples = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(samples16));
+            const __m128 mixed = _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_mul_ps(samples, gain));
+            _mm_storeu_ps(dst + i * 2, mixed);
+
+            frameIndex = _mm_add_epi32(frameIndex, frameStep);
+        }
+        MixS16StereoRange(dst, src, i, frames, ramp);
+    }
+
+    void ResolveS16Sse4_1(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        const __m128 lower = _mm_set1_ps(-32768.0f);
+        const __m128 upper = _mm_set1_ps(32767.0f);
+
+        int32_t i = 0;
+        for (; i + 8 <= samples; i += 8)
+        {
+            const __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lower), upper);
+            const __m128 b = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lower), upper);
+            const __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(a), _mm_cvttps_epi32(b));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+        }
+        ResolveS16Scalar(dst + i, src + i, samples - i);
+    }
+} // namespace OpenRCT2::Audio
+
+#else
+
+#    ifdef OPENRCT2_X86
+#        error You have to compile this file with SSE4.1 enabled, when targeting x86!
+#    endif
+
+namespace OpenRCT2::Audio
+{
+    void MixS16StereoSse4_1(float* RESTRICT dst, const int16_t* RESTRICT src, int32_t frames, const MixRamp& ramp)
+    {
+        Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+    }
+
+    void ResolveS16Sse4_1(int16_t* RESTRICT dst, const float* RESTRICT src, int32_t samples)
+    {
+        Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+    }
+} // namespace OpenRCT2::Audio
+
+#endif // __SSE4_1__
@@ -0,0 +1,847 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Console.hpp"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../ParkImporter.h"
+#    include "../audio/AudioMixing.h"
+#    include "../core/DataSerialiser.h"
+#    include "../core/File.h"
+#    include "../core/Imaging.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../drawing/Drawing.h"
+#    include "../drawing/ImageImporter.h"
+#    include "../entity/EntityList.h"
+#    include "../entity/EntityRegistry.h"
+#    include "../entity/Guest.h"
+#    include "../localisation/Language.h"
+#    include "../localisation/LanguagePack.h"
+#    include "../platform/Platform.h"
+#    include "../rct1/RCT1.h"
+#    include "../rct12/SawyerChunkReader.h"
+#    include "../rct2/RCT2.h"
+#    include "../ride/Ride.h"
+#    include "../ride/Vehicle.h"
+#    include "../scenario/Scenario.h"
+#    include "../util/SawyerCoding.h"
+#    include "../world/Map.h"
+#    include "../world/TileElementsView.h"
+
+#    include <array>
+#    include <benchmark/benchmark.h>
+#    include <limits>
+#    include <memory>
+#    include <sstream>
+#    include <vector>
+
+#endif
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleBenchImages(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchLanguages(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchMixer(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchSawyer(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchSerialiser(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchSprites(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchTiles(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchTracks(CommandLineArgEnumerator* argEnumerator);
+
+// clang-format off
+const CommandLineCommand CommandLine::BenchCommands[]
+{
+    DefineCommand("images",     "[benchmark options]",           nullptr, HandleBenchImages    ),
+    DefineCommand("languages",  "<file>... [benchmark options]", nullptr, HandleBenchLanguages ),
+    DefineCommand("mixer",      "[benchmark options]",           nullptr, HandleBenchMixer     ),
+    DefineCommand("sawyer",     "<file>... [benchmark options]", nullptr, HandleBenchSawyer    ),
+    DefineCommand("serialiser", "[benchmark options]",           nullptr, HandleBenchSerialiser),
+    DefineCommand("sprites",    "[benchmark options]",           nullptr, HandleBenchSprites   ),
+    DefineCommand("tiles",      "[benchmark options]",           nullptr, HandleBenchTiles     ),
+    DefineCommand("tracks",     "<file> [benchmark options]",    nullptr, HandleBenchTracks    ),
+    CommandTableEnd
+};
+// clang-format on
+
+#ifdef USE_BENCHMARK
+
+static exitcode_t RunBenchmarks(CommandLineArgEnumerator* argEnumerator)
+{
+    // Any remaining arguments are passed on to Google Benchmark, e.g. --benchmark_format=json
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("openrct2"));
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument))
+    {
+        argv.push_back(const_cast<char*>(argument));
+    }
+
+    auto argc = static_cast<int>(argv.size());
+    benchmark::Initialize(&argc, argv.data());
+    if (benchmark::ReportUnrecognizedArguments(argc, argv.data()))
+    {
+        return EXITCODE_FAIL;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::ClearRegisteredBenchmarks();
+    return EXITCODE_OK;
+}
+
+// A 32-bit image with smooth gradients, noise and transparent areas, like a rendered object sprite sheet
+static Image CreateBenchmarkImage(uint32_t size)
+{
+    Image image;
+    image.Width = size;
+    image.Height = size;
+    image.Depth = 32;
+    image.Stride = size * 4;
+    image.Pixels.resize(image.Stride * size);
+    uint32_t noise = 1;
+    for (uint32_t y = 0; y < size; y++)
+    {
+        for (uint32_t x = 0; x < size; x++)
+        {
+            noise = noise * 1103515245 + 12345;
+            auto* pixel = image.Pixels.data() + y * image.Stride + x * 4;
+            pixel[0] = static_cast<uint8_t>((x * 255 / size) ^ ((noise >> 16) & 0x0F));
+            pixel[1] = static_cast<uint8_t>((y * 255 / size) ^ ((noise >> 20) & 0x0F));
+            pixel[2] = static_cast<uint8_t>(((x + y) * 127 / size) ^ ((noise >> 24) & 0x0F));
+            pixel[3] = ((x / 16 + y / 16) % 5) == 0 ? 0 : 255;
+        }
+    }
+    return image;
+}
+
+static void BenchDecodePng(benchmark::State& state)
+{
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const auto image = CreateBenchmarkImage(size);
+    std::ostringstream stream;
+    Imaging::PngWriter writer(stream, image.Width, image.Height, image.Depth, nullptr);
+    writer.WriteRows(image.Pixels.data(), image.Stride, image.Height);
+    writer.Finish();
+    const auto encoded = stream.str();
+    const std::vector<uint8_t> data(encoded.begin(), encoded.end());
+
+    for (auto _ : state)
+    {
+        auto decoded = Imaging::ReadFromBuffer(data, IMAGE_FORMAT::PNG_32);
+        benchmark::DoNotOptimize(decoded.Pixels.data());
+    }
+    state.SetBytesProcessed(state.iterations() * image.Pixels.size());
+}
+
+using FindClosestColourFunction = int32_t (*)(
+    const int32_t*, const int32_t*, const int32_t*, int32_t, int32_t, int32_t, int32_t);
+
+static void BenchFindClosestColour(benchmark::State& state, FindClosestColourFunction findClosest)
+{
+    // The whole palette, as searched for every pixel before the lookup cube
+    std::array<int32_t, PALETTE_SIZE> red;
+    std::array<int32_t, PALETTE_SIZE> green;
+    std::array<int32_t, PALETTE_SIZE> blue;
+    for (size_t i = 0; i < PALETTE_SIZE; i++)
+    {
+        red[i] = StandardPalette[i].Red;
+        green[i] = StandardPalette[i].Green;
+        blue[i] = StandardPalette[i].Blue;
+    }
+
+    constexpr int32_t kColours = 4096;
+    int32_t colour = 0;
+    for (auto _ : state)
+    {
+        for (int32_t i = 0; i < kColours; i++)
+        {
+            colour = colour * 1103515245 + 12345;
+            benchmark::DoNotOptimize(findClosest(
+                red.data(), green.data(), blue.data(), PALETTE_SIZE, (colour >> 8) & 0xFF, (colour >> 16) & 0xFF,
+                (colour >> 24) & 0xFF));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kColours);
+}
+
+static void BenchImportImage(benchmark::State& state, Drawing::ImportMode mode)
+{
+    constexpr uint32_t kImageSize = 256;
+    const auto image = CreateBenchmarkImage(kImageSize);
+
+    Drawing::ImageImporter importer;
+    for (auto _ : state)
+    {
+        Drawing::ImageImportMeta meta{};
+        meta.importMode = mode;
+        auto result = importer.Import(image, meta);
+        benchmark::DoNotOptimize(result.Buffer.data());
+    }
+    // Reported as pixels per second
+    state.SetItemsProcessed(state.iterations() * kImageSize * kImageSize);
+}
+
+static exitcode_t HandleBenchImages(CommandLineArgEnumerator* argEnumerator)
+{
+    // The argument is the width and height of the image
+    benchmark::RegisterBenchmark("Images/DecodePng", BenchDecodePng)->RangeMultiplier(4)->Range(64, 4096);
+    benchmark::RegisterBenchmark("Images/FindClosestColour/Scalar", BenchFindClosestColour, Drawing::FindClosestColourScalar);
+    if (Platform::SSE41Available())
+    {
+        benchmark::RegisterBenchmark(
+            "Images/FindClosestColour/SSE4.1", BenchFindClosestColour, Drawing::FindClosestColourSse4_1);
+    }
+    if (Platform::AVX2Available())
+    {
+        benchmark::RegisterBenchmark("Images/FindClosestColour/AVX2", BenchFindClosestColour, Drawing::FindClosestColourAvx2);
+    }
+    benchmark::RegisterBenchmark("Images/Import/Default", BenchImportImage, Drawing::ImportMode::Default);
+    benchmark::RegisterBenchmark("Images/Import/Closest", BenchImportImage, Drawing::ImportMode::Closest);
+    benchmark::RegisterBenchmark("Images/Import/Dithering", BenchImportImage, Drawing::ImportMode::Dithering);
+    return RunBenchmarks(argEnumerator);
+}
+
+static void BenchLanguageParse(benchmark::State& state, std::shared_ptr<std::string> text)
+{
+    for (auto _ : state)
+    {
+        auto languagePack = LanguagePackFactory::FromText(LANGUAGE_ENGLISH_UK, text->c_str());
+        benchmark::DoNotOptimize(languagePack);
+    }
+    state.SetBytesProcessed(state.iterations() * text->size());
+}
+
+static void BenchLanguageCompiled(benchmark::State& state, std::shared_ptr<std::vector<uint8_t>> data)
+{
+    for (auto _ : state)
+    {
+        auto languagePack = LanguagePackFactory::FromCompiled(LANGUAGE_ENGLISH_UK, *data);
+        benchmark::DoNotOptimize(languagePack);
+    }
+    state.SetBytesProcessed(state.iterations() * data->size());
+}
+
+static exitcode_t HandleBenchLanguages(CommandLineArgEnumerator* argEnumerator)
+{
+    // Leading arguments are the language files to load, anything after is passed on to Google Benchmark
+    int32_t numFiles = 0;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument))
+    {
+        if (String::StartsWith(argument, "--"))
+        {
+            argEnumerator->Backtrack();
+            break;
+        }
+
+        const auto name = Path::GetFileName(argument);
+        try
+        {
+            const auto bytes = File::ReadAllBytes(argument);
+            auto text = std::make_shared<std::string>(bytes.begin(), bytes.end());
+            auto data = std::make_shared<std::vector<uint8_t>>(
+                LanguagePackFactory::Compile(LANGUAGE_ENGLISH_UK, text->c_str()));
+            benchmark::RegisterBenchmark(("Languages/Parse/" + name).c_str(), BenchLanguageParse, text);
+            benchmark::RegisterBenchmark(("Languages/Compiled/" + name).c_str(), BenchLanguageCompiled, data);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read %s: %s", argument, e.what());
+            return EXITCODE_FAIL;
+        }
+        numFiles++;
+    }
+
+    if (numFiles == 0)
+    {
+        Console::Error::WriteLine("Expected one or more language files to load.");
+        return EXITCODE_FAIL;
+    }
+    return RunBenchmarks(argEnumerator);
+}
+
+using MixFunction = void (*)(float*, const int16_t*, int32_t, const Audio::MixRamp&);
+using ResolveFunction = void (*)(int16_t*, const float*, int32_t);
+
+static void BenchMixChannels(benchmark::State& state, MixFunction mix, ResolveFunction resolve)
+{
+    // One SDL callback worth of frames, as requested by AudioMixer::Init
+    constexpr int32_t kFrames = 2048;
+    const auto numChannels = static_cast<int32_t>(state.range(0));
+
+    std::vector<int16_t> source(kFrames * 2);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<int16_t>((i * 7919) & 0x7FFF) - 0x4000;
+    }
+    std::vector<float> bus(kFrames * 2);
+    std::vector<int16_t> output(kFrames * 2);
+
+    // Every channel pans and fades, the worst case for the mixer
+    Audio::MixRamp ramp;
+    ramp.PanL = 0.2f;
+    ramp.PanStepL = 0.8f / kFrames;
+    ramp.Volume = 0.5f;
+    ramp.VolumeStep = 0.25f / kFrames;
+
+    for (auto _ : state)
+    {
+        std::fill(bus.begin(), bus.end(), 0.0f);
+        for (int32_t channel = 0; channel < numChannels; channel++)
+        {
+            mix(bus.data(), source.data(), kFrames, ramp);
+        }
+        resolve(output.data(), bus.data(), static_cast<int32_t>(bus.size()));
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames * numChannels);
+}
+
+static exitcode_t HandleBenchMixer(CommandLineArgEnumerator* argEnumerator)
+{
+    benchmark::RegisterBenchmark("Mixer/Scalar", BenchMixChannels, Audio::MixS16StereoScalar, Audio::ResolveS16Scalar)
+        ->RangeMultiplier(4)
+        ->Range(1, 256);
+    if (Platform::SSE41Available())
+    {
+        benchmark::RegisterBenchmark(
+            "Mixer/SSE4.1", BenchMixChannels, Audio::MixS16StereoSse4_1, Audio::ResolveS16Sse4_1)
+            ->RangeMultiplier(4)
+            ->Range(1, 256);
+    }
+    if (Platform::AVX2Available())
+    {
+        benchmark::RegisterBenchmark("Mixer/AVX2", BenchMixChannels, Audio::MixS16StereoAvx2, Audio::ResolveS16Avx2)
+            ->RangeMultiplier(4)
+            ->Range(1, 256);
+    }
+    return RunBenchmarks(argEnumerator);
+}
+
+using BlitRowFunction = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t);
+using BlitRowLutFunction = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t, const uint8_t*);
+
+struct BlitRowFunctions
+{
+    const char* Name;
+    BlitRowFunction Transparent;
+    BlitRowLutFunction Remap;
+    BlitRowLutFunction RemapDst;
+};
+
+struct SawyerBenchmarkFile
+{
+    std::vector<uint8_t> Data;
+    uint64_t BodyPosition{};
+    size_t NumBodyChunks{};
+    size_t DecodedLength{};
+};
+
+static std::shared_ptr<SawyerBenchmarkFile> ReadSawyerBenchmarkFile(const std::string& path)
+{
+    // Only the chunks after the header, scenario info and packed objects are decoded, these hold the park itself
+    auto file = std::make_shared<SawyerBenchmarkFile>();
+    file->Data = File::ReadAllBytes(path);
+    auto stream = MemoryStream(file->Data.data(), file->Data.size());
+    auto chunkReader = SawyerChunkReader(&stream);
+    auto header = chunkReader.ReadChunkAs<RCT2::S6Header>();
+    if (header.Type == S6_TYPE_SCENARIO)
+    {
+        chunkReader.SkipChunk();
+    }
+    for (uint16_t i = 0; i < header.NumPackedObjects; i++)
+    {
+        stream.Seek(sizeof(RCTObjectEntry), STREAM_SEEK_CURRENT);
+        chunkReader.SkipChunk();
+    }
+
+    // The file ends with a four byte checksum
+    file->BodyPosition = stream.GetPosition();
+    while (stream.GetPosition() + 4 < stream.GetLength())
+    {
+        file->DecodedLength += chunkReader.ReadChunk()->GetLength();
+        file->NumBodyChunks++;
+    }
+    return file;
+}
+
+static void BenchSawyerDecodeSerial(benchmark::State& state, std::shared_ptr<SawyerBenchmarkFile> file)
+{
+    for (auto _ : state)
+    {
+        auto stream = MemoryStream(file->Data.data(), file->Data.size());
+        stream.SetPosition(file->BodyPosition);
+        auto chunkReader = SawyerChunkReader(&stream);
+        for (size_t i = 0; i < file->NumBodyChunks; i++)
+        {
+            benchmark::DoNotOptimize(chunkReader.ReadChunk());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * file->DecodedLength);
+}
+
+static void BenchSawyerDecodeParallel(benchmark::State& state, std::shared_ptr<SawyerBenchmarkFile> file)
+{
+    for (auto _ : state)
+    {
+        auto stream = MemoryStream(file->Data.data(), file->Data.size());
+        stream.SetPosition(file->BodyPosition);
+        auto chunkReader = SawyerChunkReader(&stream);
+        benchmark::DoNotOptimize(chunkReader.ReadChunks(file->NumBodyChunks));
+    }
+    state.SetBytesProcessed(state.iterations() * file->DecodedLength);
+}
+
+static void BenchSawyerDecodeRCT1(benchmark::State& state, std::shared_ptr<std::vector<uint8_t>> data, bool isScenario)
+{
+    // RCT1 parks are a single RLE stream, encrypted on top for scenarios released after the original game
+    auto decodedData = std::make_unique<uint8_t[]>(sizeof(RCT1::S4));
+    const auto fileType = SawyerCodingDetectFileType(data->data(), data->size());
+    const auto isEncrypted = isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1;
+    for (auto _ : state)
+    {
+        auto decodedLength = isEncrypted
+            ? SawyerCodingDecodeSC4(data->data(), decodedData.get(), data->size(), sizeof(RCT1::S4))
+            : SawyerCodingDecodeSV4(data->data(), decodedData.get(), data->size(), sizeof(RCT1::S4));
+        benchmark::DoNotOptimize(decodedLength);
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(RCT1::S4));
+}
+
+static exitcode_t HandleBenchSawyer(CommandLineArgEnumerator* argEnumerator)
+{
+    // Leading arguments are the SV6, SC6, SV4 or SC4 files to decode, anything after is passed on to Google Benchmark
+    int32_t numFiles = 0;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument))
+    {
+        if (String::StartsWith(argument, "--"))
+        {
+            argEnumerator->Backtrack();
+            break;
+        }
+
+        const auto name = Path::GetFileName(argument);
+        const auto extension = Path::GetExtension(argument);
+        try
+        {
+            if (ParkImporter::ExtensionIsRCT1(extension))
+            {
+                auto data = std::make_shared<std::vector<uint8_t>>(File::ReadAllBytes(argument));
+                benchmark::RegisterBenchmark(
+                    ("Sawyer/RCT1/" + name).c_str(), BenchSawyerDecodeRCT1, data,
+                    ParkImporter::ExtensionIsScenario(extension));
+            }
+            else
+            {
+                auto file = ReadSawyerBenchmarkFile(argument);
+                benchmark::RegisterBenchmark(("Sawyer/Serial/" + name).c_str(), BenchSawyerDecodeSerial, file);
+                benchmark::RegisterBenchmark(("Sawyer/Parallel/" + name).c_str(), BenchSawyerDecodeParallel, file)
+                    ->UseRealTime();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read %s: %s", argument, e.what());
+            return EXITCODE_FAIL;
+        }
+        numFiles++;
+    }
+
+    if (numFiles == 0)
+    {
+        Console::Error::WriteLine("Expected one or more SV6, SC6, SV4 or SC4 files to decode.");
+        return EXITCODE_FAIL;
+    }
+    return RunBenchmarks(argEnumerator);
+}
+
+// Roughly the entities of a very busy park
+static constexpr int32_t kSerialiserBenchmarkGuests = 20000;
+static constexpr int32_t kSerialiserBenchmarkVehicles = 2000;
+
+template<typename T> static void SerialiseEntities(DataSerialiser& ds)
+{
+    for (auto* entity : EntityList<T>())
+    {
+        entity->Serialise(ds);
+    }
+}
+
+template<typename T> static void BenchSerialiseEntities(benchmark::State& state)
+{
+    MemoryStream stream;
+    for (auto _ : state)
+    {
+        stream.SetPosition(0);
+        DataSerialiser ds(true, stream);
+        SerialiseEntities<T>(ds);
+    }
+    state.SetBytesProcessed(state.iterations() * stream.GetLength());
+}
+
+template<typename T> static void BenchDeserialiseEntities(benchmark::State& state)
+{
+    MemoryStream stream;
+    DataSerialiser saver(true, stream);
+    SerialiseEntities<T>(saver);
+
+    for (auto _ : state)
+    {
+        stream.SetPosition(0);
+        DataSerialiser ds(false, stream);
+        SerialiseEntities<T>(ds);
+    }
+    state.SetBytesProcessed(state.iterations() * stream.GetLength());
+}
+
+static void BenchSerialiseTileElements(benchmark::State& state, bool perElement)
+{
+    // The length of a vector is encoded in 16 bits, so this is the most elements a single vector can hold
+    std::vector<TileElement> tileElements(std::numeric_limits<uint16_t>::max());
+    for (size_t i = 0; i < tileElements.size(); i++)
+    {
+        tileElements[i].Type = static_cast<uint8_t>(i);
+        tileElements[i].BaseHeight = static_cast<uint8_t>(i >> 8);
+    }
+
+    MemoryStream stream;
+    for (auto _ : state)
+    {
+        stream.SetPosition(0);
+        DataSerialiser ds(true, stream);
+        if (perElement)
+        {
+            for (const auto& tileElement : tileElements)
+            {
+                ds << tileElement;
+            }
+        }
+        else
+        {
+            ds << tileElements;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * stream.GetLength());
+}
+
+static exitcode_t HandleBenchSerialiser(CommandLineArgEnumerator* argEnumerator)
+{
+    // Entities need a game state to live in, no objects are needed as only their fields are serialised
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    ResetAllEntities();
+    for (int32_t i = 0; i < kSerialiserBenchmarkGuests; i++)
+    {
+        CreateEntity<Guest>();
+    }
+    for (int32_t i = 0; i < kSerialiserBenchmarkVehicles; i++)
+    {
+        CreateEntity<Vehicle>();
+    }
+
+    benchmark::RegisterBenchmark("Serialiser/Guests/Save", BenchSerialiseEntities<Guest>);
+    benchmark::RegisterBenchmark("Serialiser/Guests/Load", BenchDeserialiseEntities<Guest>);
+    benchmark::RegisterBenchmark("Serialiser/Vehicles/Save", BenchSerialiseEntities<Vehicle>);
+    benchmark::RegisterBenchmark("Serialiser/Vehicles/Load", BenchDeserialiseEntities<Vehicle>);
+    benchmark::RegisterBenchmark("Serialiser/TileElements/PerElement", BenchSerialiseTileElements, true);
+    benchmark::RegisterBenchmark("Serialiser/TileElements/Vector", BenchSerialiseTileElements, false);
+    auto result = RunBenchmarks(argEnumerator);
+    ResetAllEntities();
+    return result;
+}
+
+template<typename TBlit> static void BenchBlitSprite(benchmark::State& state, TBlit blit)
+{
+    // A large scenery sized sprite, drawn row by row as the RLE and BMP sprite drawers do
+    constexpr int32_t kSpriteSize = 128;
+    const auto srcShift = static_cast<int32_t>(state.range(0));
+
+    std::vector<uint8_t> source(kSpriteSize * kSpriteSize);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        // Leave some transparent holes in the sprite
+        source[i] = (i % 11) == 0 ? 0 : static_cast<uint8_t>(i * 7919);
+    }
+    std::vector<uint8_t> destination(kSpriteSize * kSpriteSize, 0x55);
+    std::array<uint8_t, 256> lut;
+    for (size_t i = 0; i < lut.size(); i++)
+    {
+        lut[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    const auto dstWidth = kSpriteSize >> srcShift;
+    for (auto _ : state)
+    {
+        for (int32_t y = 0; y < kSpriteSize; y += 1 << srcShift)
+        {
+            const auto* src = source.data() + y * kSpriteSize;
+            auto* dst = destination.data() + (y >> srcShift) * dstWidth;
+            if constexpr (std::is_same_v<TBlit, BlitRowLutFunction>)
+            {
+                blit(src, dst, kSpriteSize, srcShift, lut.data());
+            }
+            else
+            {
+                blit(src, dst, kSpriteSize, srcShift);
+            }
+        }
+        benchmark::DoNotOptimize(destination.data());
+    }
+    // Reported as sprites per second
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void RegisterBlitBenchmarks(const BlitRowFunctions& functions)
+{
+    const std::string name = functions.Name;
+    benchmark::RegisterBenchmark(
+        ("Sprites/Transparent/" + name).c_str(), BenchBlitSprite<BlitRowFunction>, functions.Transparent)
+        ->DenseRange(0, 3);
+    benchmark::RegisterBenchmark(("Sprites/Remap/" + name).c_str(), BenchBlitSprite<BlitRowLutFunction>, functions.Remap)
+        ->DenseRange(0, 3);
+    benchmark::RegisterBenchmark(("Sprites/RemapDst/" + name).c_str(), BenchBlitSprite<BlitRowLutFunction>, functions.RemapDst)
+        ->DenseRange(0, 3);
+}
+
+static exitcode_t HandleBenchSprites(CommandLineArgEnumerator* argEnumerator)
+{
+    // The argument of each benchmark is the zoom level the sprite is drawn at
+    RegisterBlitBenchmarks({ "Scalar", BlitRowTransparentScalar, BlitRowRemapScalar, BlitRowRemapDstScalar });
+    if (Platform::SSE41Available())
+    {
+        RegisterBlitBenchmarks({ "SSE4.1", BlitRowTransparentSse4_1, BlitRowRemapSse4_1, BlitRowRemapDstSse4_1 });
+    }
+    if (Platform::AVX2Available())
+    {
+        RegisterBlitBenchmarks({ "AVX2", BlitRowTransparentAvx2, BlitRowRemapAvx2, BlitRowRemapDstAvx2 });
+    }
+    return RunBenchmarks(argEnumerator);
+}
+
+static constexpr TileCoordsXY kTileBenchmarkMapSize = { 256, 256 };
+
+static void CreateTileBenchmarkMap(int32_t sceneryPerTile)
+{
+    // Every tile is stacked with small scenery and one tile in sixteen also has a track piece, roughly the mix the
+    // guest ride search and the clear scenery tool walk through in a dense park.
+    MapInit(kTileBenchmarkMapSize);
+    for (int32_t y = 1; y < kTileBenchmarkMapSize.y - 1; y++)
+    {
+        for (int32_t x = 1; x < kTileBenchmarkMapSize.x - 1; x++)
+        {
+            const auto location = TileCoordsXY{ x, y }.ToCoordsXY();
+            for (int32_t i = 0; i < sceneryPerTile; i++)
+            {
+                TileElementInsert<SmallSceneryElement>({ location, (16 + i * 4) * kCoordsZStep }, 0b1111);
+            }
+            if (((x ^ y) & 15) == 0)
+            {
+                TileElementInsert<TrackElement>({ location, 14 * kCoordsZStep }, 0b1111);
+            }
+        }
+    }
+}
+
+static void BenchTileScanOpenCoded(benchmark::State& state)
+{
+    CreateTileBenchmarkMap(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        int32_t numTracks = 0;
+        for (int32_t y = 0; y < kTileBenchmarkMapSize.y; y++)
+        {
+            for (int32_t x = 0; x < kTileBenchmarkMapSize.x; x++)
+            {
+                const auto* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (tileElement == nullptr)
+                    continue;
+                do
+                {
+                    if (tileElement->GetType() == TileElementType::Track)
+                        numTracks++;
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        benchmark::DoNotOptimize(numTracks);
+    }
+    // Reported as tiles visited per second
+    state.SetItemsProcessed(state.iterations() * kTileBenchmarkMapSize.x * kTileBenchmarkMapSize.y);
+}
+
+static void BenchTileScanTyped(benchmark::State& state)
+{
+    CreateTileBenchmarkMap(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        int32_t numTracks = 0;
+        ForEachTileElementInRange<TrackElement>(
+            { 0, 0 }, { kTileBenchmarkMapSize.x - 1, kTileBenchmarkMapSize.y - 1 },
+            [&numTracks](const TileCoordsXY&, const TrackElement*) { numTracks++; });
+        benchmark::DoNotOptimize(numTracks);
+    }
+    state.SetItemsProcessed(state.iterations() * kTileBenchmarkMapSize.x * kTileBenchmarkMapSize.y);
+}
+
+static exitcode_t HandleBenchTiles(CommandLineArgEnumerator* argEnumerator)
+{
+    // The map needs a game state to live in, but no objects are loaded as only the element types are looked at
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // The argument of each benchmark is the number of scenery elements stacked on every tile
+    benchmark::RegisterBenchmark("Tiles/OpenCoded", BenchTileScanOpenCoded)->RangeMultiplier(2)->Range(1, 8);
+    benchmark::RegisterBenchmark("Tiles/Typed", BenchTileScanTyped)->RangeMultiplier(2)->Range(1, 8);
+    return RunBenchmarks(argEnumerator);
+}
+
+struct TrackBenchmarkPiece
+{
+    CoordsXYZ Location;
+    track_type_t TrackType;
+};
+
+static void BenchTrackNeighbours(
+    benchmark::State& state, std::shared_ptr<std::vector<TrackBenchmarkPiece>> pieces, bool useCache, bool withGhost)
+{
+    // A ghost on the tile of the first piece, as the track construction preview places and removes every tick
+    const auto& ghostLocation = pieces->front().Location;
+    for (auto _ : state)
+    {
+        TrackElement* ghost = nullptr;
+        if (withGhost)
+        {
+            ghost = TileElementInsert<TrackElement>({ ghostLocation, ghostLocation.z + 32 * kCoordsZStep }, 0b1111);
+            if (ghost != nullptr)
+            {
+                ghost->SetGhost(true);
+            }
+        }
+        for (const auto& piece : *pieces)
+        {
+            CoordsXYE next{};
+            TrackBeginEnd previous{};
+            benchmark::DoNotOptimize(VehicleGetTrackNeighbours(piece.Location, piece.TrackType, useCache, next, previous));
+        }
+        if (ghost != nullptr)
+        {
+            TileElementRemove(reinterpret_cast<TileElement*>(ghost));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * pieces->size());
+}
+
+static exitcode_t HandleBenchTracks(CommandLineArgEnumerator* argEnumerator)
+{
+    // The argument is a park with rides, each piece of its track is looked up the way cars moving onto it do
+    const char* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath) || String::StartsWith(inputPath, "--"))
+    {
+        Console::Error::WriteLine("Expected a park file with rides.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto pieces = std::make_shared<std::vector<TrackBenchmarkPiece>>();
+    const auto& mapSize = GetGameState().MapSize;
+    ForEachTileElementInRange<TrackElement>(
+        { 0, 0 }, { mapSize.x - 1, mapSize.y - 1 }, [&pieces](const TileCoordsXY& tile, const TrackElement* trackElement) {
+            if (!trackElement->IsGhost() && trackElement->GetSequenceIndex() == 0)
+            {
+                pieces->push_back({ { tile.ToCoordsXY(), trackElement->GetBaseZ() }, trackElement->GetTrackType() });
+            }
+        });
+    if (pieces->empty())
+    {
+        Console::Error::WriteLine("The park has no track.");
+        return EXITCODE_FAIL;
+    }
+
+    benchmark::RegisterBenchmark("Tracks/Uncached", BenchTrackNeighbours, pieces, false, false);
+    benchmark::RegisterBenchmark("Tracks/Cached", BenchTrackNeighbours, pieces, true, false);
+    benchmark::RegisterBenchmark("Tracks/Cached/Ghost", BenchTrackNeighbours, pieces, true, true);
+    return RunBenchmarks(argEnumerator);
+}
+
+#else
+
+static exitcode_t HandleBenchUnsupported()
+{
+    Console::Error::WriteLine("This build was compiled without Google Benchmark support.");
+    return EXITCODE_FAIL;
+}
+
+static exitcode_t HandleBenchImages(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchLanguages(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchMixer(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchSawyer(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchSerialiser(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchSprites(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchTiles(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+static exitcode_t HandleBenchTracks(CommandLineArgEnumerator* argEnumerator)
+{
+    return HandleBenchUnsupported();
+}
+
+#endif // USE_BENCHMARK
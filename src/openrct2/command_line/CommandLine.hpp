@@ -118,6 +118,7 @@ namespace OpenRCT2::CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand SimulateCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand BenchCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -125,5 +126,6 @@ namespace OpenRCT2::CommandLine
     exitcode_t HandleCommandDefault();
 
     exitcode_t HandleCommandConvert(CommandLineArgEnumerator* enumerator);
+    exitcode_t HandleCommandConvertBatch(CommandLineArgEnumerator* enumerator);
     exitcode_t HandleCommandUri(CommandLineArgEnumerator* enumerator);
 } // namespace OpenRCT2::CommandLine
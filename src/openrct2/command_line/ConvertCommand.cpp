@@ -13,20 +13,33 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../core/Timer.hpp"
 #include "../interface/Window.h"
 #include "../object/ObjectManager.h"
 #include "../park/ParkFile.h"
 #include "../scenario/Scenario.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
+#include <future>
 #include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType);
 static u8string GetFileTypeFriendlyName(FileExtension fileType);
+static std::string GetConversionErrorMessage(const std::exception& ex);
 
 exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerator)
 {
@@ -107,7 +120,7 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     }
     catch (const std::exception& ex)
     {
-        Console::Error::WriteLine(ex.what());
+        Console::Error::WriteLine("%s", GetConversionErrorMessage(ex).c_str());
         return EXITCODE_FAIL;
     }
 
@@ -137,6 +150,281 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     return EXITCODE_OK;
 }
 
+struct BatchConvertItem
+{
+    u8string SourcePath;
+    u8string DestinationPath;
+    u8string Error;
+};
+
+struct BatchConvertReadResult
+{
+    std::vector<uint8_t> Data;
+    float ReadTime{};
+};
+
+static std::vector<u8string> GetBatchConvertSources(const u8string& source, u8string& baseDirectory)
+{
+    std::vector<u8string> sources;
+    if (Path::DirectoryExists(source))
+    {
+        baseDirectory = source;
+        auto scanner = Path::ScanDirectory(Path::Combine(source, u8"*.sc4;*.sv4;*.sc6;*.sv6"), true);
+        while (scanner->Next())
+        {
+            sources.push_back(scanner->GetPath());
+        }
+        // Scan order depends on the file system, sort so the output is the same on every run
+        std::sort(sources.begin(), sources.end());
+    }
+    else if (GetFileExtensionType(source) != FileExtension::Unknown)
+    {
+        baseDirectory = Path::GetDirectory(source);
+        sources.push_back(source);
+    }
+    else
+    {
+        // A manifest lists one park per line, relative paths are relative to the manifest
+        baseDirectory = Path::GetDirectory(source);
+        for (const auto& line : File::ReadAllLines(source))
+        {
+            auto path = String::Trim(line);
+            if (path.empty() || String::StartsWith(path, "#"))
+            {
+                continue;
+            }
+            sources.push_back(Path::IsAbsolute(path) ? path : Path::GetAbsolute(Path::Combine(baseDirectory, path)));
+        }
+    }
+    return sources;
+}
+
+static u8string GetBatchConvertDestination(
+    const u8string& sourcePath, const u8string& baseDirectory, const u8string& destinationDirectory)
+{
+    // Keep the directory layout of the source, parks from outside the source directory go to the top level
+    auto relativePath = Path::GetRelative(sourcePath, baseDirectory);
+    if (relativePath.empty() || String::StartsWith(relativePath, "..") || Path::IsAbsolute(relativePath))
+    {
+        relativePath = Path::GetFileName(sourcePath);
+    }
+    return Path::WithExtension(Path::Combine(destinationDirectory, relativePath), ".park");
+}
+
+/**
+ * Parks that only differ in their extension, such as foo.sv6 and foo.sc6, would be written to the same destination.
+ * None of them are converted, rather than the last one silently replacing the others.
+ */
+static void MarkDuplicateBatchConvertDestinations(std::vector<BatchConvertItem>& items)
+{
+    std::unordered_map<u8string, std::vector<size_t>> itemsByDestination;
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        if (!items[i].DestinationPath.empty())
+        {
+            itemsByDestination[items[i].DestinationPath].push_back(i);
+        }
+    }
+
+    for (const auto& [destination, indices] : itemsByDestination)
+    {
+        if (indices.size() < 2)
+        {
+            continue;
+        }
+        for (auto index : indices)
+        {
+            auto& item = items[index];
+            item.Error = "Destination is shared with";
+            for (auto otherIndex : indices)
+            {
+                if (otherIndex != index)
+                {
+                    item.Error += " '" + items[otherIndex].SourcePath + "'";
+                }
+            }
+        }
+    }
+}
+
+static BatchConvertReadResult ReadBatchConvertSource(const u8string& path)
+{
+    Timer timer;
+    BatchConvertReadResult result;
+    result.Data = File::ReadAllBytes(path);
+    result.ReadTime = timer.GetElapsedTime().count();
+    return result;
+}
+
+static void ConvertBatchItem(
+    IContext& context, const BatchConvertItem& item, const std::vector<uint8_t>& data, json_t& timings)
+{
+    const auto extension = Path::GetExtension(item.SourcePath);
+    const auto sourceFileType = GetFileExtensionType(item.SourcePath);
+    auto& gameState = GetGameState();
+    Timer timer;
+
+    auto stream = MemoryStream(data.data(), data.size());
+    auto importer = ParkImporter::Create(item.SourcePath);
+    auto loadResult = importer->LoadFromStream(
+        &stream, ParkImporter::ExtensionIsScenario(extension), false, item.SourcePath);
+    timings["load"] = timer.GetElapsedTimeAndRestart().count();
+
+    context.GetObjectManager().LoadObjects(loadResult.RequiredObjects);
+    timings["objects"] = timer.GetElapsedTimeAndRestart().count();
+
+    importer->Import(gameState);
+    if (sourceFileType == FileExtension::SC4 || sourceFileType == FileExtension::SC6)
+    {
+        // We are converting a scenario, so reset the park
+        ScenarioBegin(gameState);
+    }
+    timings["import"] = timer.GetElapsedTimeAndRestart().count();
+
+    if (!item.DestinationPath.empty())
+    {
+        Path::CreateDirectory(Path::GetDirectory(item.DestinationPath));
+        auto exporter = std::make_unique<ParkFileExporter>();
+
+        // HACK remove the main window so it saves the park with the
+        //      correct initial view
+        WindowCloseByClass(WindowClass::MainWindow);
+
+        exporter->Export(gameState, item.DestinationPath);
+        timings["export"] = timer.GetElapsedTimeAndRestart().count();
+    }
+}
+
+exitcode_t CommandLine::HandleCommandConvertBatch(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const utf8* rawSource;
+    if (!enumerator->TryPopString(&rawSource))
+    {
+        Console::Error::WriteLine("Expected a source directory or manifest.");
+        return EXITCODE_FAIL;
+    }
+    const auto source = Path::GetAbsolute(rawSource);
+    if (!Path::DirectoryExists(source) && !File::Exists(source))
+    {
+        Console::Error::WriteLine("Source '%s' does not exist.", source.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    // Without a destination the parks are only loaded and imported to check they are valid
+    u8string destinationDirectory;
+    const utf8* rawDestination;
+    if (enumerator->TryPopString(&rawDestination))
+    {
+        destinationDirectory = Path::GetAbsolute(rawDestination);
+    }
+
+    u8string baseDirectory;
+    std::vector<BatchConvertItem> items;
+    for (auto& sourcePath : GetBatchConvertSources(source, baseDirectory))
+    {
+        BatchConvertItem item;
+        if (!destinationDirectory.empty())
+        {
+            item.DestinationPath = GetBatchConvertDestination(sourcePath, baseDirectory, destinationDirectory);
+        }
+        item.SourcePath = std::move(sourcePath);
+        items.push_back(std::move(item));
+    }
+    MarkDuplicateBatchConvertDestinations(items);
+
+    // One context is shared by every park so the object repository is scanned once
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // The game state is global so parks are imported one at a time, source files are read ahead on other threads
+    const size_t readAhead = std::max(1u, std::thread::hardware_concurrency());
+    std::deque<std::future<BatchConvertReadResult>> pendingReads;
+    size_t nextRead = 0;
+    size_t numConverted = 0;
+    Timer batchTimer;
+    for (const auto& item : items)
+    {
+        while (nextRead < items.size() && pendingReads.size() < readAhead)
+        {
+            if (items[nextRead].Error.empty())
+            {
+                pendingReads.push_back(std::async(std::launch::async, ReadBatchConvertSource, items[nextRead].SourcePath));
+            }
+            nextRead++;
+        }
+
+        auto itemResult = json_t::object();
+        itemResult["source"] = item.SourcePath;
+        if (!item.DestinationPath.empty())
+        {
+            itemResult["destination"] = item.DestinationPath;
+        }
+
+        if (!item.Error.empty())
+        {
+            itemResult["result"] = "error";
+            itemResult["error"] = item.Error;
+        }
+        else
+        {
+            auto pendingRead = std::move(pendingReads.front());
+            pendingReads.pop_front();
+
+            auto timings = json_t::object();
+            Timer itemTimer;
+            try
+            {
+                auto readResult = pendingRead.get();
+                timings["read"] = readResult.ReadTime;
+
+                ConvertBatchItem(*context, item, readResult.Data, timings);
+                itemResult["result"] = "ok";
+                numConverted++;
+            }
+            catch (const std::exception& ex)
+            {
+                itemResult["result"] = "error";
+                itemResult["error"] = GetConversionErrorMessage(ex);
+            }
+            timings["total"] = itemTimer.GetElapsedTime().count();
+            itemResult["seconds"] = timings;
+        }
+
+        // One JSON object per line, so the output can be processed while the batch is still running
+        const auto line = itemResult.dump(-1, ' ', false, json_t::error_handler_t::replace);
+        Console::WriteLine("%s", line.c_str());
+    }
+
+    Console::Error::WriteLine(
+        "Converted %zu of %zu parks in %.2f seconds.", numConverted, items.size(), batchTimer.GetElapsedTime().count());
+    return numConverted == items.size() ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static std::string GetConversionErrorMessage(const std::exception& ex)
+{
+    if (const auto* objectLoadException = dynamic_cast<const ObjectLoadException*>(&ex))
+    {
+        std::string message = "Missing objects:";
+        for (const auto& entry : objectLoadException->MissingObjects)
+        {
+            message += " " + entry.ToString();
+        }
+        return message;
+    }
+    return ex.what();
+}
+
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType)
 {
     const auto sourceFileTypeName = GetFileTypeFriendlyName(sourceFileType);
@@ -23,11 +23,15 @@
 #include "MemoryStream.h"
 #include "StringTypes.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 template<typename T> struct DataSerializerTraitsT
 {
@@ -142,6 +146,109 @@ template<> struct DataSerializerTraitsT<int64_t> : public DataSerializerTraitsIn
 {
 };
 
+/**
+ * Describes how contiguous arrays of a type can be serialised in bulk. Block types are encoded as their in-memory bytes,
+ * byte swapped when wider than a byte, so a whole array can be written or read with a single stream call instead of one
+ * call per element. Types that are not block types are serialised element by element through their traits.
+ */
+template<typename T> struct DataSerializerBlockTraits
+{
+    static constexpr bool IsBlock = std::is_integral_v<T> || std::is_enum_v<T>;
+    static constexpr bool ByteSwap = IsBlock && sizeof(T) > 1;
+
+    static T Swap(const T& val)
+    {
+        return ByteSwapBE(val);
+    }
+};
+
+template<typename T, T TNull, typename TTag> struct DataSerializerBlockTraits<TIdentifier<T, TNull, TTag>>
+{
+    static_assert(sizeof(TIdentifier<T, TNull, TTag>) == sizeof(T));
+    static constexpr bool IsBlock = true;
+    static constexpr bool ByteSwap = sizeof(T) > 1;
+
+    static TIdentifier<T, TNull, TTag> Swap(const TIdentifier<T, TNull, TTag>& id)
+    {
+        return TIdentifier<T, TNull, TTag>::FromUnderlying(ByteSwapBE(id.ToUnderlying()));
+    }
+};
+
+template<> struct DataSerializerBlockTraits<TileElement>
+{
+    static_assert(std::is_trivially_copyable_v<TileElement>);
+    static constexpr bool IsBlock = true;
+    static constexpr bool ByteSwap = false;
+};
+
+template<typename T> struct DataSerializerTraitsBlock
+{
+    using Traits = DataSerializerBlockTraits<T>;
+
+    static void encode(OpenRCT2::IStream* stream, const T* values, size_t count)
+    {
+        if constexpr (!Traits::IsBlock)
+        {
+            DataSerializerTraits<T> s;
+            for (size_t i = 0; i < count; i++)
+            {
+                s.encode(stream, values[i]);
+            }
+        }
+        else if constexpr (!Traits::ByteSwap)
+        {
+            stream->Write(values, count * sizeof(T));
+        }
+        else
+        {
+            // Swap through a small buffer so the stream still only sees a few large writes
+            std::array<T, 256> buffer;
+            for (size_t offset = 0; offset < count; offset += buffer.size())
+            {
+                const auto chunkCount = std::min(buffer.size(), count - offset);
+                for (size_t i = 0; i < chunkCount; i++)
+                {
+                    buffer[i] = Traits::Swap(values[offset + i]);
+                }
+                stream->Write(buffer.data(), chunkCount * sizeof(T));
+            }
+        }
+    }
+    static void decode(OpenRCT2::IStream* stream, T* values, size_t count)
+    {
+        if constexpr (!Traits::IsBlock)
+        {
+            DataSerializerTraits<T> s;
+            for (size_t i = 0; i < count; i++)
+            {
+                s.decode(stream, values[i]);
+            }
+        }
+        else
+        {
+            stream->Read(values, count * sizeof(T));
+            if constexpr (Traits::ByteSwap)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    values[i] = Traits::Swap(values[i]);
+                }
+            }
+        }
+    }
+    static void log(OpenRCT2::IStream* stream, const T* values, size_t count)
+    {
+        stream->Write("{", 1);
+        DataSerializerTraits<T> s;
+        for (size_t i = 0; i < count; i++)
+        {
+            s.log(stream, values[i]);
+            stream->Write("; ", 2);
+        }
+        stream->Write("}", 1);
+    }
+};
+
 template<> struct DataSerializerTraitsT<std::string>
 {
     static void encode(OpenRCT2::IStream* stream, const std::string& str)
@@ -273,11 +380,7 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.encode(stream, sub);
-        }
+        DataSerializerTraitsBlock<_Ty>::encode(stream, val, _Size);
     }
     static void decode(OpenRCT2::IStream* stream, _Ty (&val)[_Size])
     {
@@ -288,22 +391,11 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.decode(stream, sub);
-        }
+        DataSerializerTraitsBlock<_Ty>::decode(stream, val, _Size);
     }
     static void log(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
     {
-        stream->Write("{", 1);
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.log(stream, sub);
-            stream->Write("; ", 2);
-        }
-        stream->Write("}", 1);
+        DataSerializerTraitsBlock<_Ty>::log(stream, val, _Size);
     }
 };
 
@@ -341,11 +433,7 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsT<std::array<_Ty
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.encode(stream, sub);
-        }
+        DataSerializerTraitsBlock<_Ty>::encode(stream, val.data(), _Size);
     }
     static void decode(OpenRCT2::IStream* stream, std::array<_Ty, _Size>& val)
     {
@@ -356,22 +444,49 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsT<std::array<_Ty
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.decode(stream, sub);
-        }
+        DataSerializerTraitsBlock<_Ty>::decode(stream, val.data(), _Size);
     }
     static void log(OpenRCT2::IStream* stream, const std::array<_Ty, _Size>& val)
     {
-        stream->Write("{", 1);
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        DataSerializerTraitsBlock<_Ty>::log(stream, val.data(), _Size);
+    }
+};
+
+/**
+ * Spans are serialised like a std::array of the same length, so that a run of values owned by something else, such as
+ * the fields of an entity, can be written in one go. Decoding fills the span and requires the lengths to match.
+ */
+template<typename _Ty> struct DataSerializerTraitsT<std::span<_Ty>>
+{
+    static void encode(OpenRCT2::IStream* stream, const std::span<_Ty>& val)
+    {
+        uint16_t len = static_cast<uint16_t>(val.size());
+        uint16_t swapped = ByteSwapBE(len);
+        stream->Write(&swapped);
+
+        DataSerializerTraitsBlock<std::remove_const_t<_Ty>>::encode(stream, val.data(), val.size());
+    }
+    static void decode(OpenRCT2::IStream* stream, std::span<_Ty>& val)
+    {
+        if constexpr (std::is_const_v<_Ty>)
         {
-            s.log(stream, sub);
-            stream->Write("; ", 2);
+            throw std::runtime_error("Can't decode into a span of const values");
+        }
+        else
+        {
+            uint16_t len;
+            stream->Read(&len);
+            len = ByteSwapBE(len);
+
+            if (len != val.size())
+                throw std::runtime_error("Invalid size, can't decode");
+
+            DataSerializerTraitsBlock<_Ty>::decode(stream, val.data(), val.size());
         }
-        stream->Write("}", 1);
+    }
+    static void log(OpenRCT2::IStream* stream, const std::span<_Ty>& val)
+    {
+        DataSerializerTraitsBlock<std::remove_const_t<_Ty>>::log(stream, val.data(), val.size());
     }
 };
 
@@ -383,11 +498,7 @@ template<typename _Ty> struct DataSerializerTraitsT<std::vector<_Ty>>
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.encode(stream, sub);
-        }
+        DataSerializerTraitsBlock<_Ty>::encode(stream, val.data(), len);
     }
     static void decode(OpenRCT2::IStream* stream, std::vector<_Ty>& val)
     {
@@ -395,24 +506,27 @@ template<typename _Ty> struct DataSerializerTraitsT<std::vector<_Ty>>
         stream->Read(&len);
         len = ByteSwapBE(len);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto i = 0; i < len; ++i)
+        if constexpr (DataSerializerBlockTraits<_Ty>::IsBlock)
         {
-            _Ty sub{};
-            s.decode(stream, sub);
-            val.push_back(std::move(sub));
+            // Decoded elements are appended, grow the vector once and decode straight into it
+            const auto offset = val.size();
+            val.resize(offset + len);
+            DataSerializerTraitsBlock<_Ty>::decode(stream, val.data() + offset, len);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto i = 0; i < len; ++i)
+            {
+                _Ty sub{};
+                s.decode(stream, sub);
+                val.push_back(std::move(sub));
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const std::vector<_Ty>& val)
     {
-        stream->Write("{", 1);
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
-        {
-            s.log(stream, sub);
-            stream->Write("; ", 2);
-        }
-        stream->Write("}", 1);
+        DataSerializerTraitsBlock<_Ty>::log(stream, val.data(), val.size());
     }
 };
 
@@ -446,37 +560,16 @@ template<> struct DataSerializerTraitsT<MapRange>
 
 template<> struct DataSerializerTraitsT<TileElement>
 {
+    // All fields of a tile element are bytes, so it is encoded as its raw 16 bytes
+    static_assert(sizeof(TileElement) == 16);
+
     static void encode(OpenRCT2::IStream* stream, const TileElement& tileElement)
     {
-        stream->WriteValue(tileElement.Type);
-        stream->WriteValue(tileElement.Flags);
-        stream->WriteValue(tileElement.BaseHeight);
-        stream->WriteValue(tileElement.ClearanceHeight);
-        stream->WriteValue(tileElement.Owner);
-        for (auto v : tileElement.Pad05)
-        {
-            stream->WriteValue(v);
-        }
-        for (auto v : tileElement.Pad08)
-        {
-            stream->WriteValue(v);
-        }
+        stream->Write(&tileElement, sizeof(TileElement));
     }
     static void decode(OpenRCT2::IStream* stream, TileElement& tileElement)
     {
-        tileElement.Type = stream->ReadValue<uint8_t>();
-        tileElement.Flags = stream->ReadValue<uint8_t>();
-        tileElement.BaseHeight = stream->ReadValue<uint8_t>();
-        tileElement.ClearanceHeight = stream->ReadValue<uint8_t>();
-        tileElement.Owner = stream->ReadValue<uint8_t>();
-        for (auto& v : tileElement.Pad05)
-        {
-            v = stream->ReadValue<uint8_t>();
-        }
-        for (auto& v : tileElement.Pad08)
-        {
-            v = stream->ReadValue<uint8_t>();
-        }
+        stream->Read(&tileElement, sizeof(TileElement));
     }
     static void log(OpenRCT2::IStream* stream, const TileElement& tileElement)
     {
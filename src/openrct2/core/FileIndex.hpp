@@ -22,8 +22,11 @@
 
 #include <chrono>
 #include <list>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -37,12 +40,27 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct IndexedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
+    // A scanned file and the item created from it, files that are not valid items are remembered as well so that they
+    // are not read again until they change
+    struct IndexEntry
+    {
+        IndexedFile File;
+        std::optional<TItem> Item;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<IndexedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<IndexedFile>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
@@ -61,7 +79,7 @@ private:
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -98,31 +116,24 @@ public:
 
     /**
      * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * the items are loaded from the index and returned, otherwise the index is updated,
+     * only reading the files that were added or changed since it was last written.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto [upToDate, entries] = ReadIndexFile(language, scanResult.Stats);
+        if (!upToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            entries = Build(language, scanResult, std::move(entries));
         }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
-        }
-        return items;
+        return GetItems(std::move(entries));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        return GetItems(Build(language, scanResult, {}));
     }
 
 protected:
@@ -140,7 +151,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<IndexedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
@@ -160,59 +171,127 @@ private:
                 stats.FileDateModifiedChecksum = OpenRCT2::Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo.Size, fileInfo.LastModified });
             }
         }
         return ScanResult(stats, std::move(files));
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the entries for all scanned files. Entries of the previous index are reused for files whose size and
+     * modification time have not changed, all other files are read again.
+     */
+    std::vector<IndexEntry> Build(
+        int32_t language, const ScanResult& scanResult, std::vector<IndexEntry>&& previousEntries) const
     {
-        std::vector<TItem> allItems;
-        OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const size_t totalCount = scanResult.Files.size();
+        std::vector<IndexEntry> entries(totalCount);
+
+        std::unordered_map<std::string_view, IndexEntry*> previousEntriesByPath;
+        for (auto& entry : previousEntries)
+        {
+            previousEntriesByPath.emplace(entry.File.Path, &entry);
+        }
+
+        std::vector<size_t> changedFiles;
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto it = previousEntriesByPath.find(file.Path);
+            if (it != previousEntriesByPath.end() && it->second->File.Size == file.Size
+                && it->second->File.LastModified == file.LastModified)
+            {
+                entries[i] = std::move(*it->second);
+            }
+            else
+            {
+                entries[i].File = file;
+                changedFiles.push_back(i);
+            }
+        }
+
+        if (previousEntries.empty())
+        {
+            OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
+        else
+        {
+            OpenRCT2::Console::WriteLine(
+                "Updating %s (%zu of %zu items changed)", _name.c_str(), changedFiles.size(), totalCount);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t changedCount = changedFiles.size();
+        if (changedCount > 0)
         {
             JobPool jobPool;
-            std::mutex mtx;
             std::atomic<size_t> processed{ 0 };
 
-            for (size_t i = 0; i < totalCount; i++)
+            for (auto index : changedFiles)
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
-
-                    if (auto item = Create(language, filePath); item.has_value())
-                    {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
-                    }
-
+                jobPool.AddTask([&, index]() {
+                    // Each job only touches its own entry
+                    entries[index].Item = Create(language, entries[index].File.Path);
                     processed++;
                 });
             }
 
             jobPool.Join([&]() {
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
+                OpenRCT2::GetContext()->SetProgress(
+                    static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(changedCount));
             });
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, entries);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         OpenRCT2::Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
 
-        return allItems;
+        return entries;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<IndexEntry>&& entries)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
+        items.reserve(entries.size());
+        for (auto& entry : entries)
+        {
+            if (entry.Item.has_value())
+            {
+                items.push_back(std::move(entry.Item.value()));
+            }
+        }
+        return items;
+    }
+
+    void SerialiseEntry(DataSerialiser& ds, IndexEntry& entry) const
+    {
+        ds << entry.File.Path;
+        ds << entry.File.Size;
+        ds << entry.File.LastModified;
+
+        bool hasItem = entry.Item.has_value();
+        ds << hasItem;
+        if (hasItem)
+        {
+            if (ds.IsLoading())
+            {
+                entry.Item.emplace();
+            }
+            Serialise(ds, entry.Item.value());
+        }
+    }
+
+    /**
+     * Reads the entries of the index file. The entries are returned as long as the index was written for the same
+     * version and language, the first value tells whether the directories have also not changed since.
+     */
+    std::tuple<bool, std::vector<IndexEntry>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    {
+        bool upToDate = false;
+        std::vector<IndexEntry> entries;
         if (OpenRCT2::File::Exists(_indexPath))
         {
             try
@@ -220,40 +299,39 @@ private:
                 LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the entries can be used at all and if we need to re-scan
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    entries.resize(header.NumItems);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (auto& entry : entries)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        SerialiseEntry(ds, entry);
+                    }
+
+                    upToDate = header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!upToDate)
+                    {
+                        OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
                     }
-                    loadedItems = true;
-                }
-                else
-                {
-                    OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
                 }
             }
             catch (const std::exception& e)
             {
                 OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                upToDate = false;
+                entries.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(upToDate, std::move(entries));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<IndexEntry>& entries) const
     {
         try
         {
@@ -268,14 +346,14 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumItems = static_cast<uint32_t>(entries.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write entries
+            for (auto& entry : entries)
             {
-                Serialise(ds, item);
+                SerialiseEntry(ds, entry);
             }
         }
         catch (const std::exception& e)
@@ -62,8 +62,9 @@ namespace OpenRCT2::Imaging
 
     static Image ReadPng(std::istream& istream, bool expandTo32)
     {
-        png_structp png_ptr;
-        png_infop info_ptr;
+        png_structp png_ptr = nullptr;
+        png_infop info_ptr = nullptr;
+        std::vector<uint8_t> pngPixels;
 
         try
         {
@@ -89,61 +90,49 @@ namespace OpenRCT2::Imaging
             int sig_read = 0;
             png_set_read_fn(png_ptr, &istream, PngReadData);
             png_set_sig_bytes(png_ptr, sig_read);
-
-            uint32_t readFlags = PNG_TRANSFORM_STRIP_16 | PNG_TRANSFORM_PACKING;
-            if (expandTo32)
-            {
-                // If we expand the resulting image always be full RGBA
-                readFlags |= PNG_TRANSFORM_GRAY_TO_RGB | PNG_TRANSFORM_EXPAND;
-            }
-            png_read_png(png_ptr, info_ptr, readFlags, nullptr);
+            png_read_info(png_ptr, info_ptr);
 
             // Read header
             png_uint_32 pngWidth, pngHeight;
             int bitDepth, colourType, interlaceType;
             png_get_IHDR(png_ptr, info_ptr, &pngWidth, &pngHeight, &bitDepth, &colourType, &interlaceType, nullptr, nullptr);
 
-            // Read pixels as 32bpp RGBA data
-            auto rowBytes = png_get_rowbytes(png_ptr, info_ptr);
-            auto rowPointers = png_get_rows(png_ptr, info_ptr);
-            auto pngPixels = std::vector<uint8_t>(pngWidth * pngHeight * 4);
-            auto dst = pngPixels.data();
-            if (colourType == PNG_COLOR_TYPE_RGB)
+            // Let libpng convert the rows while decoding them, rather than converting the whole image afterwards
+            png_set_strip_16(png_ptr);
+            png_set_packing(png_ptr);
+            if (expandTo32)
             {
-                // 24-bit PNG (no alpha)
-                Guard::Assert(rowBytes == pngWidth * 3, GUARD_LINE);
-                for (png_uint_32 i = 0; i < pngHeight; i++)
-                {
-                    auto src = rowPointers[i];
-                    for (png_uint_32 x = 0; x < pngWidth; x++)
-                    {
-                        *dst++ = *src++;
-                        *dst++ = *src++;
-                        *dst++ = *src++;
-                        *dst++ = 255;
-                    }
-                }
+                // If we expand the resulting image always be full RGBA
+                png_set_expand(png_ptr);
+                png_set_gray_to_rgb(png_ptr);
+                png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
             }
-            else if (bitDepth == 8 && !expandTo32)
+            else if (colourType == PNG_COLOR_TYPE_RGB)
             {
-                // 8-bit paletted or greyscale
-                Guard::Assert(rowBytes == pngWidth, GUARD_LINE);
-                for (png_uint_32 i = 0; i < pngHeight; i++)
-                {
-                    std::copy_n(rowPointers[i], rowBytes, dst);
-                    dst += rowBytes;
-                }
+                // 24-bit PNG (no alpha)
+                png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
             }
-            else
+            const auto numPasses = png_set_interlace_handling(png_ptr);
+            png_read_update_info(png_ptr, info_ptr);
+
+            const auto rowBytes = png_get_rowbytes(png_ptr, info_ptr);
+            if (expandTo32)
             {
-                // 32-bit PNG (with alpha)
                 Guard::Assert(rowBytes == pngWidth * 4, GUARD_LINE);
-                for (png_uint_32 i = 0; i < pngHeight; i++)
+            }
+
+            // Decode the rows straight into the image, interlaced images fill in the same rows on every pass
+            pngPixels.resize(rowBytes * pngHeight);
+            for (int32_t pass = 0; pass < numPasses; pass++)
+            {
+                auto dst = pngPixels.data();
+                for (png_uint_32 y = 0; y < pngHeight; y++)
                 {
-                    std::copy_n(rowPointers[i], rowBytes, dst);
+                    png_read_row(png_ptr, dst, nullptr);
                     dst += rowBytes;
                 }
             }
+            png_read_end(png_ptr, nullptr);
 
             // Close the PNG
             png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
@@ -164,93 +153,167 @@ namespace OpenRCT2::Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    struct PngWriter::Impl
     {
-        png_structp png_ptr = nullptr;
-        png_colorp png_palette = nullptr;
-        try
+        std::ofstream File;
+        std::ostream* Stream{};
+        png_structp Png{};
+        png_infop Info{};
+        png_colorp Palette{};
+        uint32_t Width{};
+        uint32_t Height{};
+        uint32_t RowsWritten{};
+
+        ~Impl()
         {
-            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
-            if (png_ptr == nullptr)
+            if (Png != nullptr)
             {
-                throw std::runtime_error("png_create_write_struct failed.");
+                png_free(Png, Palette);
+                png_destroy_write_struct(&Png, &Info);
             }
+        }
+    };
 
-            png_text text_ptr[1];
-            text_ptr[0].key = const_cast<char*>("Software");
-            text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
-            text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
+    PngWriter::PngWriter(std::string_view path, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+        : _impl(std::make_unique<Impl>())
+    {
+        _impl->File.open(fs::u8path(path), std::ios::binary);
+        if (!_impl->File.is_open())
+        {
+            throw std::runtime_error("Unable to open file for writing.");
+        }
+        Begin(_impl->File, width, height, depth, palette);
+    }
 
-            auto info_ptr = png_create_info_struct(png_ptr);
-            if (info_ptr == nullptr)
-            {
-                throw std::runtime_error("png_create_info_struct failed.");
-            }
+    PngWriter::PngWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+        : _impl(std::make_unique<Impl>())
+    {
+        Begin(ostream, width, height, depth, palette);
+    }
 
-            if (image.Depth == 8)
-            {
-                if (image.Palette == nullptr)
-                {
-                    throw std::runtime_error("Expected a palette for 8-bit image.");
-                }
+    PngWriter::~PngWriter() = default;
 
-                // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
-                {
-                    throw std::runtime_error("png_malloc failed.");
-                }
-                for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
-                {
-                    const auto& entry = (*image.Palette)[i];
-                    png_palette[i].blue = entry.Blue;
-                    png_palette[i].green = entry.Green;
-                    png_palette[i].red = entry.Red;
-                }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
-            }
+    void PngWriter::Begin(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+    {
+        _impl->Stream = &ostream;
+        _impl->Width = width;
+        _impl->Height = height;
+
+        auto& png_ptr = _impl->Png;
+        png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+        if (png_ptr == nullptr)
+        {
+            throw std::runtime_error("png_create_write_struct failed.");
+        }
 
-            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+        png_text text_ptr[1];
+        text_ptr[0].key = const_cast<char*>("Software");
+        text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
+        text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
 
-            // Set error handler
-            if (setjmp(png_jmpbuf(png_ptr)))
+        auto& info_ptr = _impl->Info;
+        info_ptr = png_create_info_struct(png_ptr);
+        if (info_ptr == nullptr)
+        {
+            throw std::runtime_error("png_create_info_struct failed.");
+        }
+
+        if (depth == 8)
+        {
+            if (palette == nullptr)
             {
-                throw std::runtime_error("PNG ERROR");
+                throw std::runtime_error("Expected a palette for 8-bit image.");
             }
 
-            // Write header
-            auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            // Set the palette
+            auto& png_palette = _impl->Palette;
+            png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+            if (png_palette == nullptr)
             {
-                png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
-                colourType = PNG_COLOR_TYPE_PALETTE;
+                throw std::runtime_error("png_malloc failed.");
             }
-            png_set_text(png_ptr, info_ptr, text_ptr, 1);
-            png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
-                PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(png_ptr, info_ptr);
-
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                const auto& entry = (*palette)[i];
+                png_palette[i].blue = entry.Blue;
+                png_palette[i].green = entry.Green;
+                png_palette[i].red = entry.Red;
             }
+            png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+        }
 
-            png_write_end(png_ptr, nullptr);
-            png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
+        png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+
+        // Set error handler
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
         }
-        catch (const std::exception&)
+
+        // Write header
+        auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
+        if (depth == 8)
         {
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
-            throw;
+            png_byte transparentIndex = 0;
+            png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
+            colourType = PNG_COLOR_TYPE_PALETTE;
+        }
+        png_set_text(png_ptr, info_ptr, text_ptr, 1);
+        png_set_IHDR(
+            png_ptr, info_ptr, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+            PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(png_ptr, info_ptr);
+    }
+
+    void PngWriter::WriteRows(const uint8_t* pixels, uint32_t stride, uint32_t numRows)
+    {
+        auto png_ptr = _impl->Png;
+        if (_impl->RowsWritten + numRows > _impl->Height)
+        {
+            throw std::out_of_range("More rows written than the image contains.");
         }
+
+        // Set error handler
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+
+        for (uint32_t y = 0; y < numRows; y++)
+        {
+            png_write_row(png_ptr, const_cast<png_byte*>(pixels));
+            pixels += stride;
+        }
+        _impl->RowsWritten += numRows;
+    }
+
+    void PngWriter::Finish()
+    {
+        auto png_ptr = _impl->Png;
+        if (_impl->RowsWritten != _impl->Height)
+        {
+            throw std::runtime_error("Not all rows of the image have been written.");
+        }
+
+        // Set error handler
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+
+        png_write_end(png_ptr, nullptr);
+        _impl->Stream->flush();
+        if (!*_impl->Stream)
+        {
+            throw std::runtime_error("Unable to write image.");
+        }
+    }
+
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        PngWriter writer(ostream, image.Width, image.Height, image.Depth, image.Palette.get());
+        writer.WriteRows(image.Pixels.data(), image.Stride, image.Height);
+        writer.Finish();
     }
 
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
@@ -14,6 +14,7 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <ostream>
 #include <string_view>
 #include <vector>
 
@@ -51,4 +52,26 @@ namespace OpenRCT2::Imaging
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    /**
+     * Encodes a PNG a band of rows at a time, so that images too large to hold in memory
+     * can be written as they are produced.
+     */
+    class PngWriter
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> _impl;
+
+    public:
+        PngWriter(std::string_view path, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette);
+        PngWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette);
+        ~PngWriter();
+
+        void WriteRows(const uint8_t* pixels, uint32_t stride, uint32_t numRows);
+        void Finish();
+
+    private:
+        void Begin(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette);
+    };
 } // namespace OpenRCT2::Imaging
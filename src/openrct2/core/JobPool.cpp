@@ -11,6 +11,8 @@
 
 #include <cassert>
 
+static thread_local bool _isWorkerThread = false;
+
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
     : WorkFn(workFn)
     , CompletionFn(completionFn)
@@ -101,8 +103,15 @@ size_t JobPool::CountProcessing()
     return _processing;
 }
 
+bool JobPool::IsWorkerThread()
+{
+    return _isWorkerThread;
+}
+
 void JobPool::ProcessQueue()
 {
+    _isWorkerThread = true;
+
     unique_lock lock(_mutex);
     do
     {
@@ -48,6 +48,12 @@ public:
     size_t CountPending();
     size_t CountProcessing();
 
+    /**
+     * Returns true on the threads of any job pool. Work done there is already spread over the cores, so it should not
+     * start a job pool of its own.
+     */
+    static bool IsWorkerThread();
+
 private:
     void ProcessQueue();
 };
@@ -9,9 +9,14 @@
 
 #include "Zip.h"
 
+#include "File.h"
 #include "IStream.hpp"
 
+#include <list>
+#include <mutex>
+
 #ifndef __ANDROID__
+#    include <unordered_map>
 #    include <zip.h>
 #endif
 
@@ -64,6 +69,91 @@ bool IZipArchive::Exists(std::string_view path) const
     return GetIndexFromPath(path).has_value();
 }
 
+namespace OpenRCT2::Zip
+{
+    struct SharedArchive
+    {
+        std::string Path;
+        uint64_t Size{};
+        uint64_t LastModified{};
+        std::shared_ptr<IZipArchive> Archive;
+    };
+
+    // Enough for the object files of a park together with the asset packs
+    static constexpr size_t kMaxSharedArchives = 16;
+
+    // Most recently used first
+    static std::list<SharedArchive> _sharedArchives;
+    static std::mutex _sharedArchivesMutex;
+
+    static std::shared_ptr<IZipArchive> GetSharedArchive(std::string_view path, uint64_t size, uint64_t lastModified)
+    {
+        for (auto it = _sharedArchives.begin(); it != _sharedArchives.end(); it++)
+        {
+            if (it->Path == path)
+            {
+                if (it->Size == size && it->LastModified == lastModified)
+                {
+                    _sharedArchives.splice(_sharedArchives.begin(), _sharedArchives, it);
+                    return it->Archive;
+                }
+
+                // The file has changed since it was opened
+                _sharedArchives.erase(it);
+                break;
+            }
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<IZipArchive> OpenShared(std::string_view path)
+    {
+        const auto size = File::GetSize(path);
+        const auto lastModified = File::GetLastModified(path);
+        {
+            std::lock_guard lock(_sharedArchivesMutex);
+            if (auto archive = GetSharedArchive(path, size, lastModified))
+            {
+                return archive;
+            }
+        }
+
+        // Open outside of the lock so that other archives can still be used in the meantime
+        std::shared_ptr<IZipArchive> archive = Open(path, ZIP_ACCESS::READ);
+
+        std::lock_guard lock(_sharedArchivesMutex);
+        if (auto openedMeanwhile = GetSharedArchive(path, size, lastModified))
+        {
+            return openedMeanwhile;
+        }
+        _sharedArchives.push_front({ std::string(path), size, lastModified, archive });
+        if (_sharedArchives.size() > kMaxSharedArchives)
+        {
+            _sharedArchives.pop_back();
+        }
+        return archive;
+    }
+
+    std::shared_ptr<IZipArchive> TryOpenShared(std::string_view path)
+    {
+        std::shared_ptr<IZipArchive> result;
+        try
+        {
+            result = OpenShared(path);
+        }
+        catch (const std::exception&)
+        {
+        }
+        return result;
+    }
+
+    void CloseShared()
+    {
+        std::lock_guard lock(_sharedArchivesMutex);
+        _sharedArchives.clear();
+    }
+} // namespace OpenRCT2::Zip
+
 #ifndef __ANDROID__
 
 class ZipArchive final : public IZipArchive
@@ -73,6 +163,13 @@ private:
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
 
+    // libzip handles can not be used from several threads at once, shared archives are though
+    mutable std::mutex _mutex;
+
+    // Normalised path to index of the first file with that path, built on the first lookup
+    mutable std::unordered_map<std::string, size_t> _pathIndex;
+    mutable bool _pathIndexBuilt{};
+
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
     {
@@ -99,38 +196,36 @@ public:
 
     size_t GetNumFiles() const override
     {
+        std::lock_guard lock(_mutex);
         return zip_get_num_entries(_zip, 0);
     }
 
     std::string GetFileName(size_t index) const override
     {
-        std::string result;
-        auto name = zip_get_name(_zip, index, ZIP_FL_ENC_GUESS);
-        if (name != nullptr)
-        {
-            result = name;
-        }
-        return result;
+        std::lock_guard lock(_mutex);
+        return GetFileNameUnlocked(index);
     }
 
     uint64_t GetFileSize(size_t index) const override
     {
-        zip_stat_t zipFileStat;
-        if (zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
-        {
-            return zipFileStat.size;
-        }
+        std::lock_guard lock(_mutex);
+        return GetFileSizeUnlocked(index);
+    }
 
-        return 0;
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        std::lock_guard lock(_mutex);
+        return GetIndexFromPathUnlocked(path);
     }
 
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
+        std::lock_guard lock(_mutex);
         std::vector<uint8_t> result;
-        auto index = GetIndexFromPath(path);
+        auto index = GetIndexFromPathUnlocked(path);
         if (index.has_value())
         {
-            auto dataSize = GetFileSize(index.value());
+            auto dataSize = GetFileSizeUnlocked(index.value());
             if (dataSize > 0 && dataSize < SIZE_MAX)
             {
                 auto zipFile = zip_fopen_index(_zip, index.value(), 0);
@@ -151,23 +246,27 @@ public:
 
     std::unique_ptr<IStream> GetFileStream(std::string_view path) const override
     {
-        auto index = GetIndexFromPath(path);
+        std::lock_guard lock(_mutex);
+        auto index = GetIndexFromPathUnlocked(path);
         if (index.has_value())
         {
-            return std::make_unique<ZipItemStream>(_zip, index.value());
+            return std::make_unique<ZipItemStream>(_zip, _mutex, index.value());
         }
         return {};
     }
 
     void SetFileData(std::string_view path, std::vector<uint8_t>&& data) override
     {
+        std::lock_guard lock(_mutex);
+        InvalidatePathIndex();
+
         // Push buffer to an internal list as libzip requires access to it until the zip
         // handle is closed.
         _writeBuffers.push_back(std::move(data));
         const auto& writeBuffer = *_writeBuffers.rbegin();
 
         auto source = zip_source_buffer(_zip, writeBuffer.data(), writeBuffer.size(), 0);
-        auto index = GetIndexFromPath(path);
+        auto index = GetIndexFromPathUnlocked(path);
         zip_int64_t res = 0;
         if (index.has_value())
         {
@@ -186,9 +285,11 @@ public:
 
     void DeleteFile(std::string_view path) override
     {
-        auto index = GetIndexFromPath(path);
+        std::lock_guard lock(_mutex);
+        auto index = GetIndexFromPathUnlocked(path);
         if (index.has_value())
         {
+            InvalidatePathIndex();
             zip_delete(_zip, index.value());
         }
         else
@@ -199,9 +300,11 @@ public:
 
     void RenameFile(std::string_view path, std::string_view newPath) override
     {
-        auto index = GetIndexFromPath(path);
+        std::lock_guard lock(_mutex);
+        auto index = GetIndexFromPathUnlocked(path);
         if (index)
         {
+            InvalidatePathIndex();
             zip_file_rename(_zip, *index, newPath.data(), ZIP_FL_ENC_GUESS);
         }
         else
@@ -211,29 +314,90 @@ public:
     }
 
 private:
+    std::string GetFileNameUnlocked(size_t index) const
+    {
+        std::string result;
+        auto name = zip_get_name(_zip, index, ZIP_FL_ENC_GUESS);
+        if (name != nullptr)
+        {
+            result = name;
+        }
+        return result;
+    }
+
+    uint64_t GetFileSizeUnlocked(size_t index) const
+    {
+        zip_stat_t zipFileStat;
+        if (zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
+        {
+            return zipFileStat.size;
+        }
+
+        return 0;
+    }
+
+    std::optional<size_t> GetIndexFromPathUnlocked(std::string_view path) const
+    {
+        if (!_pathIndexBuilt)
+        {
+            auto numFiles = static_cast<size_t>(zip_get_num_entries(_zip, 0));
+            _pathIndex.reserve(numFiles);
+            for (size_t i = 0; i < numFiles; i++)
+            {
+                auto normalisedZipPath = NormalisePath(GetFileNameUnlocked(i));
+                if (!normalisedZipPath.empty())
+                {
+                    // Keeps the first file when there are several with the same path
+                    _pathIndex.emplace(std::move(normalisedZipPath), i);
+                }
+            }
+            _pathIndexBuilt = true;
+        }
+
+        auto it = _pathIndex.find(NormalisePath(path));
+        if (it != _pathIndex.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    void InvalidatePathIndex()
+    {
+        _pathIndex.clear();
+        _pathIndexBuilt = false;
+    }
+
     class ZipItemStream final : public IStream
     {
     private:
         zip* _zip;
+        std::mutex& _mutex;
         zip_int64_t _index;
         zip_file_t* _zipFile{};
         zip_uint64_t _len{};
         zip_uint64_t _pos{};
+        bool _stored{};
 
     public:
-        ZipItemStream(zip* zip, zip_int64_t index)
+        // Expects the archive mutex to be locked by the caller
+        ZipItemStream(zip* zip, std::mutex& mutex, zip_int64_t index)
             : _zip(zip)
+            , _mutex(mutex)
             , _index(index)
         {
             zip_stat_t zipFileStat{};
             if (zip_stat_index(_zip, _index, 0, &zipFileStat) == ZIP_ER_OK)
             {
                 _len = zipFileStat.size;
+                _stored = (zipFileStat.valid & ZIP_STAT_COMP_METHOD) && zipFileStat.comp_method == ZIP_CM_STORE
+                    && (!(zipFileStat.valid & ZIP_STAT_ENCRYPTION_METHOD) || zipFileStat.encryption_method == ZIP_EM_NONE);
             }
         }
 
         ~ZipItemStream() override
         {
+            std::lock_guard lock(_mutex);
             Close();
         }
 
@@ -259,6 +423,17 @@ private:
 
         void SetPosition(uint64_t position) override
         {
+            std::lock_guard lock(_mutex);
+            if (_stored && position <= _len && (_zipFile != nullptr || Reset()))
+            {
+                // Stored files are not compressed, so they can be seeked without reading the skipped bytes
+                if (zip_fseek(_zipFile, static_cast<zip_int64_t>(position), SEEK_SET) == 0)
+                {
+                    _pos = position;
+                    return;
+                }
+            }
+
             if (position > _pos)
             {
                 // Read to seek forwards
@@ -304,6 +479,7 @@ private:
 
         uint64_t TryRead(void* buffer, uint64_t length) override
         {
+            std::lock_guard lock(_mutex);
             if (_zipFile == nullptr && !Reset())
             {
                 return 0;
@@ -360,6 +536,11 @@ private:
         {
             // zip_fseek can not be used on compressed data, so skip bytes by
             // reading into a temporary buffer
+            if (_zipFile == nullptr && !Reset())
+            {
+                return;
+            }
+
             char buffer[2048]{};
             while (len > 0)
             {
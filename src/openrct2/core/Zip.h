@@ -45,7 +45,10 @@ struct IZipArchive
     virtual void DeleteFile(std::string_view path) = 0;
     virtual void RenameFile(std::string_view path, std::string_view newPath) = 0;
 
-    [[nodiscard]] std::optional<size_t> GetIndexFromPath(std::string_view path) const;
+    /**
+     * Finds the index of the first file with the given path, with either kind of directory separator.
+     */
+    [[nodiscard]] virtual std::optional<size_t> GetIndexFromPath(std::string_view path) const;
     [[nodiscard]] bool Exists(std::string_view path) const;
 };
 
@@ -59,4 +62,17 @@ namespace OpenRCT2::Zip
 {
     [[nodiscard]] std::unique_ptr<IZipArchive> Open(std::string_view path, ZIP_ACCESS zipAccess);
     [[nodiscard]] std::unique_ptr<IZipArchive> TryOpen(std::string_view path, ZIP_ACCESS zipAccess);
+
+    /**
+     * Opens a zip file for reading, reusing the archive already opened for the same path as long as the file has not
+     * changed since. The recently used archives are kept open, so repeatedly reading assets from one zip file does not
+     * reread its central directory each time.
+     */
+    [[nodiscard]] std::shared_ptr<IZipArchive> OpenShared(std::string_view path);
+    [[nodiscard]] std::shared_ptr<IZipArchive> TryOpenShared(std::string_view path);
+
+    /**
+     * Closes the shared archives that are not in use anymore, so the files can be modified or deleted.
+     */
+    void CloseShared();
 } // namespace OpenRCT2::Zip
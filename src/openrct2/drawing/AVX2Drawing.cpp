@@ -9,10 +9,12 @@
 
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "ImageImporter.h"
 
 #ifdef __AVX2__
 
 #    include <immintrin.h>
+#    include <limits>
 
 void MaskAvx2(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
@@ -41,6 +43,189 @@ void MaskAvx2(
     }
 }
 
+/**
+ * Loads 16 pixels, taking every (1 << srcShift)th byte from src, for srcShift > 0.
+ */
+static __m128i LoadSampledPixels16(const uint8_t* src, int32_t srcShift)
+{
+    const auto load = [src](int32_t index) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index * 16)); };
+    switch (srcShift)
+    {
+        case 1:
+        {
+            const __m128i mask = _mm_set1_epi16(0xFF);
+            return _mm_packus_epi16(_mm_and_si128(load(0), mask), _mm_and_si128(load(1), mask));
+        }
+        case 2:
+        {
+            const __m128i mask = _mm_set1_epi32(0xFF);
+            const __m128i lo = _mm_packus_epi32(_mm_and_si128(load(0), mask), _mm_and_si128(load(1), mask));
+            const __m128i hi = _mm_packus_epi32(_mm_and_si128(load(2), mask), _mm_and_si128(load(3), mask));
+            return _mm_packus_epi16(lo, hi);
+        }
+        default:
+        {
+            const __m128i mask = _mm_set1_epi64x(0xFF);
+            __m128i quads[4];
+            for (int32_t i = 0; i < 4; i++)
+            {
+                quads[i] = _mm_packus_epi32(_mm_and_si128(load(i * 2), mask), _mm_and_si128(load(i * 2 + 1), mask));
+            }
+            const __m128i lo = _mm_packus_epi32(quads[0], quads[1]);
+            const __m128i hi = _mm_packus_epi32(quads[2], quads[3]);
+            return _mm_packus_epi16(lo, hi);
+        }
+    }
+}
+
+/**
+ * Loads 32 pixels, taking every (1 << srcShift)th byte from src.
+ */
+static __m256i LoadSampledPixels(const uint8_t* src, int32_t srcShift)
+{
+    if (srcShift == 0)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    }
+    const __m128i lo = LoadSampledPixels16(src, srcShift);
+    const __m128i hi = LoadSampledPixels16(src + (16 << srcShift), srcShift);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+/**
+ * Looks up 32 palette indices in lut. Byte shuffles can only index 16 entries at a time, so going through memory is
+ * faster than assembling the result from 16 shuffles.
+ */
+static __m256i LookupPixels(__m256i indices, const uint8_t* lut)
+{
+    alignas(32) uint8_t pixels[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(pixels), indices);
+    for (auto& pixel : pixels)
+    {
+        pixel = lut[pixel];
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(pixels));
+}
+
+void BlitRowTransparentAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; ((i + 32) << srcShift) <= srcLength; i += 32)
+    {
+        const __m256i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m256i transparent = _mm256_cmpeq_epi8(pixels, zero);
+        if (_mm256_movemask_epi8(transparent) == -1)
+            continue;
+
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(pixels, dest, transparent));
+    }
+    BlitRowTransparentScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift);
+}
+
+void BlitRowRemapAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; ((i + 32) << srcShift) <= srcLength; i += 32)
+    {
+        const __m256i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m256i transparent = _mm256_cmpeq_epi8(pixels, zero);
+        if (_mm256_movemask_epi8(transparent) == -1)
+            continue;
+
+        const __m256i remapped = LookupPixels(pixels, lut);
+        const __m256i keep = _mm256_or_si256(transparent, _mm256_cmpeq_epi8(remapped, zero));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(remapped, dest, keep));
+    }
+    BlitRowRemapScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift, lut);
+}
+
+void BlitRowRemapDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; ((i + 32) << srcShift) <= srcLength; i += 32)
+    {
+        const __m256i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m256i transparent = _mm256_cmpeq_epi8(pixels, zero);
+        if (_mm256_movemask_epi8(transparent) == -1)
+            continue;
+
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i remapped = LookupPixels(dest, lut);
+        const __m256i keep = _mm256_or_si256(transparent, _mm256_cmpeq_epi8(remapped, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(remapped, dest, keep));
+    }
+    BlitRowRemapDstScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift, lut);
+}
+
+namespace OpenRCT2::Drawing
+{
+    int32_t FindClosestColourAvx2(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
+    {
+        const __m256i colourR = _mm256_set1_epi32(r);
+        const __m256i colourG = _mm256_set1_epi32(g);
+        const __m256i colourB = _mm256_set1_epi32(b);
+        const __m256i positionStep = _mm256_set1_epi32(8);
+        __m256i position = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i smallestErrors = _mm256_set1_epi32(std::numeric_limits<int32_t>::max());
+        __m256i bestMatches = _mm256_set1_epi32(-1);
+
+        int32_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i dr = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(red + i)), colourR);
+            const __m256i dg = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(green + i)), colourG);
+            const __m256i db = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(blue + i)), colourB);
+            const __m256i error = _mm256_add_epi32(
+                _mm256_add_epi32(_mm256_mullo_epi32(dr, dr), _mm256_mullo_epi32(dg, dg)), _mm256_mullo_epi32(db, db));
+
+            // Only a strictly smaller error replaces the match, so each lane keeps its first best colour
+            const __m256i smaller = _mm256_cmpgt_epi32(smallestErrors, error);
+            smallestErrors = _mm256_min_epi32(error, smallestErrors);
+            bestMatches = _mm256_blendv_epi8(bestMatches, position, smaller);
+            position = _mm256_add_epi32(position, positionStep);
+        }
+
+        alignas(32) int32_t laneErrors[8];
+        alignas(32) int32_t laneMatches[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneErrors), smallestErrors);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneMatches), bestMatches);
+
+        // Ties between lanes go to the earlier colour, the colours after the last full vector come after all of them
+        auto smallestError = std::numeric_limits<int32_t>::max();
+        int32_t bestMatch = -1;
+        for (int32_t lane = 0; lane < 8; lane++)
+        {
+            if (laneErrors[lane] < smallestError || (laneErrors[lane] == smallestError && laneMatches[lane] < bestMatch))
+            {
+                smallestError = laneErrors[lane];
+                bestMatch = laneMatches[lane];
+            }
+        }
+        for (; i < count; i++)
+        {
+            const auto dr = red[i] - r;
+            const auto dg = green[i] - g;
+            const auto db = blue[i] - b;
+            const auto error = dr * dr + dg * dg + db * db;
+            if (error < smallestError)
+            {
+                bestMatch = i;
+                smallestError = error;
+            }
+        }
+        return bestMatch;
+    }
+} // namespace OpenRCT2::Drawing
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -54,4 +239,32 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void BlitRowTransparentAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void BlitRowRemapAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void BlitRowRemapDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+namespace OpenRCT2::Drawing
+{
+    int32_t FindClosestColourAvx2(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
+    {
+        Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+        return -1;
+    }
+} // namespace OpenRCT2::Drawing
+
 #endif // __AVX2__
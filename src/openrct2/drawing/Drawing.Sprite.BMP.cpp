@@ -47,16 +47,12 @@ template<DrawBlendOp TBlendOp> static void FASTCALL DrawBMPSpriteMinify(DrawPixe
     size_t srcLineWidth = zoomLevel.ApplyTo(g1.width);
     size_t dstLineWidth = zoomLevel.ApplyInversedTo(static_cast<size_t>(dpi.width)) + dpi.pitch;
     uint8_t zoom = zoomLevel.ApplyTo(1);
+    auto srcShift = static_cast<int8_t>(zoomLevel);
     for (; height > 0; height -= zoom)
     {
-        auto nextSrc = src + srcLineWidth;
-        auto nextDst = dst + dstLineWidth;
-        for (int32_t widthRemaining = width; widthRemaining > 0; widthRemaining -= zoom, src += zoom, dst++)
-        {
-            BlitPixel<TBlendOp>(src, dst, paletteMap);
-        }
-        src = nextSrc;
-        dst = nextDst;
+        BlitSampledPixels<TBlendOp>(src, dst, paletteMap, width, srcShift);
+        src += srcLineWidth;
+        dst += dstLineWidth;
     }
 }
 
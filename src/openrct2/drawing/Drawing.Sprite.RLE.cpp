@@ -165,14 +165,7 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
             }
             else
             {
-                auto& paletteMap = args.PalMap;
-                while (numPixels > 0)
-                {
-                    BlitPixel<TBlendOp>(src, dst, paletteMap);
-                    numPixels -= zoom;
-                    src += zoom;
-                    dst++;
-                }
+                BlitSampledPixels<TBlendOp>(src, dst, args.PalMap, numPixels, TZoom);
             }
         }
     }
@@ -225,6 +225,52 @@ void MaskScalar(
     }
 }
 
+void BlitRowTransparentScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    const int32_t step = 1 << srcShift;
+    for (int32_t i = 0; i < srcLength; i += step, dst++)
+    {
+        if (src[i] != 0)
+        {
+            *dst = src[i];
+        }
+    }
+}
+
+void BlitRowRemapScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const int32_t step = 1 << srcShift;
+    for (int32_t i = 0; i < srcLength; i += step, dst++)
+    {
+        if (src[i] != 0)
+        {
+            const uint8_t pixel = lut[src[i]];
+            if (pixel != 0)
+            {
+                *dst = pixel;
+            }
+        }
+    }
+}
+
+void BlitRowRemapDstScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const int32_t step = 1 << srcShift;
+    for (int32_t i = 0; i < srcLength; i += step, dst++)
+    {
+        if (src[i] != 0)
+        {
+            const uint8_t pixel = lut[*dst];
+            if (pixel != 0)
+            {
+                *dst = pixel;
+            }
+        }
+    }
+}
+
 static Gx _g1 = {};
 static Gx _g2 = {};
 static Gx _csg = {};
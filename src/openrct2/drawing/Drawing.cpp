@@ -32,17 +32,15 @@ using namespace OpenRCT2;
 
 const PaletteMap& PaletteMap::GetDefault()
 {
-    static bool initialised = false;
+    // Initialised as a function static so objects loading on worker threads can share it safely
     static uint8_t data[256];
-    static PaletteMap defaultMap(data);
-    if (!initialised)
-    {
+    static PaletteMap defaultMap = []() {
         for (size_t i = 0; i < sizeof(data); i++)
         {
             data[i] = static_cast<uint8_t>(i);
         }
-        initialised = true;
-    }
+        return PaletteMap(data);
+    }();
     return defaultMap;
 }
 
@@ -82,6 +80,11 @@ uint8_t PaletteMap::Blend(uint8_t src, uint8_t dst) const
     return (*this)[idx];
 }
 
+const uint8_t* PaletteMap::GetLookupTable() const
+{
+    return _dataLength >= 256 ? _data : nullptr;
+}
+
 void PaletteMap::Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length)
 {
     auto maxLength = std::min(_mapLength - srcIndex, _mapLength - dstIndex);
@@ -694,6 +697,51 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+struct BlitRowFunctions
+{
+    decltype(&BlitRowTransparentScalar) Transparent;
+    decltype(&BlitRowRemapScalar) Remap;
+    decltype(&BlitRowRemapDstScalar) RemapDst;
+};
+
+static BlitRowFunctions GetBlitRowFunctions()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 sprite row functions");
+        return { BlitRowTransparentAvx2, BlitRowRemapAvx2, BlitRowRemapDstAvx2 };
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 sprite row functions");
+        return { BlitRowTransparentSse4_1, BlitRowRemapSse4_1, BlitRowRemapDstSse4_1 };
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar sprite row functions");
+        return { BlitRowTransparentScalar, BlitRowRemapScalar, BlitRowRemapDstScalar };
+    }
+}
+
+static const auto BlitRowFuncs = GetBlitRowFunctions();
+
+void BlitRowTransparent(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    BlitRowFuncs.Transparent(src, dst, srcLength, srcShift);
+}
+
+void BlitRowRemap(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    BlitRowFuncs.Remap(src, dst, srcLength, srcShift, lut);
+}
+
+void BlitRowRemapDst(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    BlitRowFuncs.RemapDst(src, dst, srcLength, srcShift, lut);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
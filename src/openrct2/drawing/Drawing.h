@@ -19,6 +19,7 @@
 #include "Text.h"
 
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -404,6 +405,11 @@ public:
     uint8_t& operator[](size_t index);
     uint8_t operator[](size_t index) const;
     uint8_t Blend(uint8_t src, uint8_t dst) const;
+
+    /**
+     * Gets the first map as a table that can be indexed by any palette index, or nullptr if the map is shorter.
+     */
+    const uint8_t* GetLookupTable() const;
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
 };
 
@@ -625,6 +631,84 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+/*
+ * Sprite row kernels. Each one draws a row of ceil(srcLength / (1 << srcShift)) pixels to dst, sampling every
+ * (1 << srcShift)th source pixel so zoomed out views can be drawn directly, srcShift is 0 to 3. Source pixels of 0 are
+ * transparent.
+ *
+ * Transparent copies the source pixels.
+ * Remap draws the source pixels through lut, a remapped pixel of 0 is transparent too.
+ * RemapDst draws lut[dst] under the source pixels, as used for glass, a remapped pixel of 0 is left untouched.
+ */
+void BlitRowTransparentScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift);
+void BlitRowTransparentSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift);
+void BlitRowTransparentAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift);
+void BlitRowRemapScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapDstScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapDstSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+
+void BlitRowTransparent(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift);
+void BlitRowRemap(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+void BlitRowRemapDst(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut);
+
+/**
+ * Draws a row of sprite pixels at the given zoom out shift, using a row kernel when there is one for the blend op.
+ */
+template<DrawBlendOp TBlendOp>
+void FASTCALL
+    BlitSampledPixels(const uint8_t* src, uint8_t* dst, const PaletteMap& paletteMap, int32_t srcLength, int32_t srcShift)
+{
+    if constexpr (TBlendOp == BLEND_NONE)
+    {
+        if (srcShift == 0)
+        {
+            if (srcLength > 0)
+            {
+                std::memcpy(dst, src, srcLength);
+            }
+            return;
+        }
+    }
+    else if constexpr (TBlendOp == BLEND_TRANSPARENT)
+    {
+        BlitRowTransparent(src, dst, srcLength, srcShift);
+        return;
+    }
+    else if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_SRC))
+    {
+        if (auto lut = paletteMap.GetLookupTable(); lut != nullptr)
+        {
+            BlitRowRemap(src, dst, srcLength, srcShift, lut);
+            return;
+        }
+    }
+    else if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_DST))
+    {
+        if (auto lut = paletteMap.GetLookupTable(); lut != nullptr)
+        {
+            BlitRowRemapDst(src, dst, srcLength, srcShift, lut);
+            return;
+        }
+    }
+
+    const int32_t zoom = 1 << srcShift;
+    for (; srcLength > 0; srcLength -= zoom, src += zoom, dst++)
+    {
+        BlitPixel<TBlendOp>(src, dst, paletteMap);
+    }
+}
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
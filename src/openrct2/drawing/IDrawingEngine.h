@@ -50,6 +50,17 @@ namespace OpenRCT2::Drawing
 {
     struct IDrawingContext;
 
+    /**
+     * How much of the screen was redrawn in the last frame, for engines with DEF_DIRTY_OPTIMISATIONS. Moving entities
+     * dirty their old and new position, while tile edits and map animations dirty whatever their callers pass to
+     * MapInvalidateTile and its variants.
+     */
+    struct DirtyRegionStats
+    {
+        uint32_t RepaintedRects{};
+        uint64_t RepaintedPixels{};
+    };
+
     struct IDrawingEngine
     {
         virtual ~IDrawingEngine()
@@ -76,6 +87,8 @@ namespace OpenRCT2::Drawing
         virtual DRAWING_ENGINE_FLAGS GetFlags() = 0;
 
         virtual void InvalidateImage(uint32_t image) = 0;
+
+        virtual DirtyRegionStats GetDirtyRegionStats() = 0;
     };
 
     struct IDrawingEngineFactory
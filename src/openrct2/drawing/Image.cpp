@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <list>
+#include <mutex>
 
 using namespace OpenRCT2;
 
@@ -27,6 +28,8 @@ constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
+// Objects may be loaded from worker threads, guards the free lists and the image list elements they own
+static std::mutex _imageListMutex;
 
 #ifdef DEBUG_LEVEL_1
 static std::list<ImageList> _allocatedLists;
@@ -195,6 +198,7 @@ uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
         return ImageIndexUndefined;
     }
 
+    std::lock_guard<std::mutex> guard(_imageListMutex);
     uint32_t baseImageId = AllocateImageList(count);
     if (baseImageId == ImageIndexUndefined)
     {
@@ -217,6 +221,8 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != ImageIndexUndefined)
     {
+        std::lock_guard<std::mutex> guard(_imageListMutex);
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
@@ -233,6 +239,7 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
 
 void GfxObjectCheckAllImagesFreed()
 {
+    std::lock_guard<std::mutex> guard(_imageListMutex);
     if (_allocatedImageCount != 0)
     {
 #ifdef DEBUG_LEVEL_1
@@ -245,6 +252,7 @@ void GfxObjectCheckAllImagesFreed()
 
 size_t ImageListGetUsedCount()
 {
+    std::lock_guard<std::mutex> guard(_imageListMutex);
     return _allocatedImageCount;
 }
 
@@ -9,11 +9,17 @@
 
 #include "ImageImporter.h"
 
+#include "../Diagnostic.h"
 #include "../core/Imaging.h"
 #include "../core/Json.hpp"
+#include "../platform/Platform.h"
 #include "../util/Util.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -21,6 +27,179 @@ namespace OpenRCT2::Drawing
 {
     constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+    /**
+     * Finds palette indices for colours without going through the whole palette for every pixel. Exact matches are
+     * looked up in the sorted palette colours. For closest matches the colour cube is split into cells, each cell only
+     * keeps the colours that can be the closest one to some colour within it, so only a handful are compared.
+     */
+    class PaletteLookup
+    {
+    private:
+        static constexpr int32_t kCellBits = 4;
+        static constexpr int32_t kCellsPerAxis = 256 >> kCellBits;
+
+        struct Cell
+        {
+            uint32_t Offset{};
+            uint32_t Count{};
+        };
+
+        // Each entry is the colour in the upper 24 bits and the palette index in the lower 8 bits
+        std::array<uint32_t, PALETTE_SIZE> _sortedColours{};
+
+        // Candidate colours of all cells, as separate channels for the matching kernels
+        std::vector<int32_t> _red;
+        std::vector<int32_t> _green;
+        std::vector<int32_t> _blue;
+        std::vector<uint8_t> _index;
+        std::vector<Cell> _cells;
+        Cell _allCandidates;
+
+    public:
+        PaletteLookup(const GamePalette& palette, bool (*isCandidate)(int32_t))
+        {
+            for (uint32_t i = 0; i < PALETTE_SIZE; i++)
+            {
+                _sortedColours[i] = (PackColour(palette[i].Red, palette[i].Green, palette[i].Blue) << 8) | i;
+            }
+            // Sorting the palette index along keeps the first of any duplicate colours first
+            std::sort(_sortedColours.begin(), _sortedColours.end());
+
+            std::vector<int32_t> candidates;
+            for (int32_t i = 0; i < static_cast<int32_t>(PALETTE_SIZE); i++)
+            {
+                if (isCandidate(i))
+                {
+                    candidates.push_back(i);
+                }
+            }
+            _allCandidates = AddCandidates(palette, candidates);
+
+            _cells.resize(kCellsPerAxis * kCellsPerAxis * kCellsPerAxis);
+            std::vector<int32_t> cellCandidates;
+            for (int32_t r = 0; r < kCellsPerAxis; r++)
+            {
+                for (int32_t g = 0; g < kCellsPerAxis; g++)
+                {
+                    for (int32_t b = 0; b < kCellsPerAxis; b++)
+                    {
+                        GetCellCandidates(palette, candidates, { r, g, b }, cellCandidates);
+                        _cells[GetCellIndex(r, g, b)] = AddCandidates(palette, cellCandidates);
+                    }
+                }
+            }
+        }
+
+        int32_t FindExact(const int16_t* colour) const
+        {
+            if (!IsInRange(colour))
+            {
+                return PALETTE_TRANSPARENT;
+            }
+
+            const auto key = PackColour(colour[0], colour[1], colour[2]);
+            auto it = std::lower_bound(_sortedColours.begin(), _sortedColours.end(), key << 8);
+            if (it != _sortedColours.end() && (*it >> 8) == key)
+            {
+                return *it & 0xFF;
+            }
+            return PALETTE_TRANSPARENT;
+        }
+
+        int32_t FindClosest(const int16_t* colour) const
+        {
+            // Dithering can push colours outside of the cube, those have to be compared with every colour
+            const Cell* cell = &_allCandidates;
+            if (IsInRange(colour))
+            {
+                cell = &_cells[GetCellIndex(colour[0] >> kCellBits, colour[1] >> kCellBits, colour[2] >> kCellBits)];
+            }
+
+            const auto position = FindClosestColour(
+                _red.data() + cell->Offset, _green.data() + cell->Offset, _blue.data() + cell->Offset,
+                static_cast<int32_t>(cell->Count), colour[0], colour[1], colour[2]);
+            if (position < 0)
+            {
+                return PALETTE_TRANSPARENT;
+            }
+            return _index[cell->Offset + position];
+        }
+
+    private:
+        static uint32_t PackColour(int32_t r, int32_t g, int32_t b)
+        {
+            return (r << 16) | (g << 8) | b;
+        }
+
+        static bool IsInRange(const int16_t* colour)
+        {
+            return colour[0] >= 0 && colour[0] <= 255 && colour[1] >= 0 && colour[1] <= 255 && colour[2] >= 0
+                && colour[2] <= 255;
+        }
+
+        static int32_t GetCellIndex(int32_t r, int32_t g, int32_t b)
+        {
+            return (r * kCellsPerAxis + g) * kCellsPerAxis + b;
+        }
+
+        /**
+         * Gets the candidates that are the closest colour to at least one colour in the cell. A colour can only be the
+         * closest if it is nearer to the nearest point of the cell than the colour with the nearest farthest point is to
+         * the farthest point, which also keeps every colour that ties with the closest one.
+         */
+        static void GetCellCandidates(
+            const GamePalette& palette, const std::vector<int32_t>& candidates, const std::array<int32_t, 3>& cell,
+            std::vector<int32_t>& cellCandidates)
+        {
+            constexpr int32_t kCellSize = 1 << kCellBits;
+
+            std::vector<std::pair<int32_t, int32_t>> distances;
+            distances.reserve(candidates.size());
+            auto smallestMaxDistance = std::numeric_limits<int32_t>::max();
+            for (auto index : candidates)
+            {
+                const int32_t channels[] = { palette[index].Red, palette[index].Green, palette[index].Blue };
+                int32_t minDistance = 0;
+                int32_t maxDistance = 0;
+                for (int32_t c = 0; c < 3; c++)
+                {
+                    const auto low = cell[c] * kCellSize;
+                    const auto high = low + kCellSize - 1;
+                    const auto nearest = std::clamp(channels[c], low, high) - channels[c];
+                    const auto farthest = std::max(std::abs(channels[c] - low), std::abs(channels[c] - high));
+                    minDistance += nearest * nearest;
+                    maxDistance += farthest * farthest;
+                }
+                distances.emplace_back(minDistance, maxDistance);
+                smallestMaxDistance = std::min(smallestMaxDistance, maxDistance);
+            }
+
+            cellCandidates.clear();
+            for (size_t i = 0; i < candidates.size(); i++)
+            {
+                if (distances[i].first <= smallestMaxDistance)
+                {
+                    cellCandidates.push_back(candidates[i]);
+                }
+            }
+        }
+
+        Cell AddCandidates(const GamePalette& palette, const std::vector<int32_t>& candidates)
+        {
+            Cell cell;
+            cell.Offset = static_cast<uint32_t>(_index.size());
+            cell.Count = static_cast<uint32_t>(candidates.size());
+            for (auto index : candidates)
+            {
+                _red.push_back(palette[index].Red);
+                _green.push_back(palette[index].Green);
+                _blue.push_back(palette[index].Blue);
+                _index.push_back(static_cast<uint8_t>(index));
+            }
+            return cell;
+        }
+    };
+
     ImageImporter::ImportResult ImageImporter::Import(const Image& image, ImageImportMeta& meta) const
     {
         if (meta.srcSize.width == 0)
@@ -112,12 +291,13 @@ namespace OpenRCT2::Drawing
         }
         else
         {
+            const auto& lookup = GetStandardPaletteLookup();
             for (auto y = 0; y < meta.srcSize.height; y++)
             {
                 for (auto x = 0; x < meta.srcSize.width; x++)
                 {
                     auto paletteIndex = CalculatePaletteIndex(
-                        meta.importMode, rgbaSrc, x, y, meta.srcSize.width, meta.srcSize.height);
+                        lookup, meta.importMode, rgbaSrc, x, y, meta.srcSize.width, meta.srcSize.height);
                     rgbaSrc += 4;
                     buffer.push_back(paletteIndex);
                 }
@@ -234,13 +414,13 @@ namespace OpenRCT2::Drawing
     }
 
     int32_t ImageImporter::CalculatePaletteIndex(
-        ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
+        const PaletteLookup& lookup, ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
     {
         auto& palette = StandardPalette;
-        auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
-        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(palette, rgbaSrc))
+        auto paletteIndex = GetPaletteIndex(lookup, rgbaSrc);
+        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(lookup, rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = GetClosestPaletteIndex(lookup, rgbaSrc);
             if (mode == ImportMode::Dithering)
             {
                 auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
@@ -252,8 +432,8 @@ namespace OpenRCT2::Drawing
 
                 if (x + 1 < width)
                 {
-                    if (!IsInPalette(palette, rgbaSrc + 4)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4)))
+                    if (!IsInPalette(lookup, rgbaSrc + 4)
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4)))
                     {
                         // Right
                         rgbaSrc[4] += dr * 7 / 16;
@@ -266,8 +446,8 @@ namespace OpenRCT2::Drawing
                 {
                     if (x > 0)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width - 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        if (!IsInPalette(lookup, rgbaSrc + 4 * (width - 1))
+                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * (width - 1))))
                         {
                             // Bottom left
                             rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -277,8 +457,8 @@ namespace OpenRCT2::Drawing
                     }
 
                     // Bottom
-                    if (!IsInPalette(palette, rgbaSrc + 4 * width)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * width)))
+                    if (!IsInPalette(lookup, rgbaSrc + 4 * width)
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * width)))
                     {
                         rgbaSrc[4 * width] += dr * 5 / 16;
                         rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -287,8 +467,8 @@ namespace OpenRCT2::Drawing
 
                     if (x + 1 < width)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width + 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        if (!IsInPalette(lookup, rgbaSrc + 4 * (width + 1))
+                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * (width + 1))))
                         {
                             // Bottom right
                             rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -303,18 +483,17 @@ namespace OpenRCT2::Drawing
         return paletteIndex;
     }
 
-    int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+    const PaletteLookup& ImageImporter::GetStandardPaletteLookup()
+    {
+        static const PaletteLookup lookup(StandardPalette, IsChangablePixel);
+        return lookup;
+    }
+
+    int32_t ImageImporter::GetPaletteIndex(const PaletteLookup& lookup, const int16_t* colour)
     {
         if (!IsTransparentPixel(colour))
         {
-            for (uint32_t i = 0; i < PALETTE_SIZE; i++)
-            {
-                if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                    && static_cast<int16_t>(palette[i].Blue) == colour[2])
-                {
-                    return i;
-                }
-            }
+            return lookup.FindExact(colour);
         }
         return PALETTE_TRANSPARENT;
     }
@@ -327,9 +506,9 @@ namespace OpenRCT2::Drawing
     /**
      * @returns true if this colour is in the standard palette.
      */
-    bool ImageImporter::IsInPalette(const GamePalette& palette, int16_t* colour)
+    bool ImageImporter::IsInPalette(const PaletteLookup& lookup, const int16_t* colour)
     {
-        return !(GetPaletteIndex(palette, colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
+        return !(GetPaletteIndex(lookup, colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
     }
 
     /**
@@ -361,30 +540,60 @@ namespace OpenRCT2::Drawing
         return PaletteIndexType::Normal;
     }
 
-    int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+    int32_t ImageImporter::GetClosestPaletteIndex(const PaletteLookup& lookup, const int16_t* colour)
+    {
+        return lookup.FindClosest(colour);
+    }
+
+    int32_t FindClosestColourScalar(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
     {
-        auto smallestError = static_cast<uint32_t>(-1);
-        auto bestMatch = PALETTE_TRANSPARENT;
-        for (uint32_t x = 0; x < PALETTE_SIZE; x++)
+        auto smallestError = std::numeric_limits<int32_t>::max();
+        int32_t bestMatch = -1;
+        for (int32_t i = 0; i < count; i++)
         {
-            if (IsChangablePixel(x))
+            const auto dr = red[i] - r;
+            const auto dg = green[i] - g;
+            const auto db = blue[i] - b;
+            const auto error = dr * dr + dg * dg + db * db;
+            if (error < smallestError)
             {
-                uint32_t error = (static_cast<int16_t>(palette[x].Red) - colour[0])
-                        * (static_cast<int16_t>(palette[x].Red) - colour[0])
-                    + (static_cast<int16_t>(palette[x].Green) - colour[1])
-                        * (static_cast<int16_t>(palette[x].Green) - colour[1])
-                    + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
-
-                if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
-                {
-                    bestMatch = x;
-                    smallestError = error;
-                }
+                bestMatch = i;
+                smallestError = error;
             }
         }
         return bestMatch;
     }
 
+    static auto GetFindClosestColourFunction()
+    {
+        if (Platform::AVX2Available())
+        {
+            LOG_VERBOSE("registering AVX2 palette matching function");
+            return FindClosestColourAvx2;
+        }
+        else if (Platform::SSE41Available())
+        {
+            LOG_VERBOSE("registering SSE4.1 palette matching function");
+            return FindClosestColourSse4_1;
+        }
+        else
+        {
+            LOG_VERBOSE("registering scalar palette matching function");
+            return FindClosestColourScalar;
+        }
+    }
+
+    static const auto FindClosestColourFunc = GetFindClosestColourFunction();
+
+    int32_t FindClosestColour(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
+    {
+        return FindClosestColourFunc(red, green, blue, count, r, g, b);
+    }
+
     ImageImportMeta createImageImportMetaFromJson(json_t& input)
     {
         auto xOffset = Json::GetNumber<int16_t>(input["x"]);
@@ -51,6 +51,8 @@ namespace OpenRCT2::Drawing
         int32_t zoomedOffset{};
     };
 
+    class PaletteLookup;
+
     /**
      * Imports images to the internal RCT G1 format.
      */
@@ -80,15 +82,35 @@ namespace OpenRCT2::Drawing
         static std::vector<uint8_t> EncodeRLE(const int32_t* pixels, ScreenSize size);
 
         static int32_t CalculatePaletteIndex(
-            ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height);
-        static int32_t GetPaletteIndex(const GamePalette& palette, int16_t* colour);
+            const PaletteLookup& lookup, ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width,
+            int32_t height);
+        static const PaletteLookup& GetStandardPaletteLookup();
+        static int32_t GetPaletteIndex(const PaletteLookup& lookup, const int16_t* colour);
         static bool IsTransparentPixel(const int16_t* colour);
-        static bool IsInPalette(const GamePalette& palette, int16_t* colour);
+        static bool IsInPalette(const PaletteLookup& lookup, const int16_t* colour);
         static bool IsChangablePixel(int32_t paletteIndex);
         static PaletteIndexType GetPaletteIndexType(int32_t paletteIndex);
-        static int32_t GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour);
+        static int32_t GetClosestPaletteIndex(const PaletteLookup& lookup, const int16_t* colour);
     };
 
+    /*
+     * Palette matching kernels. The palette colours are given as separate arrays of count channel values, the kernels
+     * return the position of the first colour with the smallest squared distance to r, g, b, or -1 if count is 0.
+     */
+    int32_t FindClosestColourScalar(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b);
+    int32_t FindClosestColourSse4_1(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b);
+    int32_t FindClosestColourAvx2(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b);
+
+    int32_t FindClosestColour(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b);
+
     // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const.
     ImageImportMeta createImageImportMetaFromJson(json_t& input);
 } // namespace OpenRCT2::Drawing
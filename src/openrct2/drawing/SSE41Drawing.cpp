@@ -9,10 +9,12 @@
 
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "ImageImporter.h"
 
 #ifdef __SSE4_1__
 
 #    include <immintrin.h>
+#    include <limits>
 
 void MaskSse4_1(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
@@ -55,6 +57,179 @@ void MaskSse4_1(
     }
 }
 
+/**
+ * Loads 16 pixels, taking every (1 << srcShift)th byte from src.
+ */
+static __m128i LoadSampledPixels(const uint8_t* src, int32_t srcShift)
+{
+    const auto load = [src](int32_t index) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index * 16)); };
+    switch (srcShift)
+    {
+        case 0:
+            return load(0);
+        case 1:
+        {
+            const __m128i mask = _mm_set1_epi16(0xFF);
+            return _mm_packus_epi16(_mm_and_si128(load(0), mask), _mm_and_si128(load(1), mask));
+        }
+        case 2:
+        {
+            // _mm_packus_epi32 is SSE4.1
+            const __m128i mask = _mm_set1_epi32(0xFF);
+            const __m128i lo = _mm_packus_epi32(_mm_and_si128(load(0), mask), _mm_and_si128(load(1), mask));
+            const __m128i hi = _mm_packus_epi32(_mm_and_si128(load(2), mask), _mm_and_si128(load(3), mask));
+            return _mm_packus_epi16(lo, hi);
+        }
+        default:
+        {
+            const __m128i mask = _mm_set1_epi64x(0xFF);
+            __m128i quads[4];
+            for (int32_t i = 0; i < 4; i++)
+            {
+                quads[i] = _mm_packus_epi32(_mm_and_si128(load(i * 2), mask), _mm_and_si128(load(i * 2 + 1), mask));
+            }
+            const __m128i lo = _mm_packus_epi32(quads[0], quads[1]);
+            const __m128i hi = _mm_packus_epi32(quads[2], quads[3]);
+            return _mm_packus_epi16(lo, hi);
+        }
+    }
+}
+
+/**
+ * Looks up 16 palette indices in lut. Byte shuffles can only index 16 entries at a time, so going through memory is
+ * faster than assembling the result from 16 shuffles.
+ */
+static __m128i LookupPixels(__m128i indices, const uint8_t* lut)
+{
+    alignas(16) uint8_t pixels[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(pixels), indices);
+    for (auto& pixel : pixels)
+    {
+        pixel = lut[pixel];
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(pixels));
+}
+
+void BlitRowTransparentSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; ((i + 16) << srcShift) <= srcLength; i += 16)
+    {
+        const __m128i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m128i transparent = _mm_cmpeq_epi8(pixels, zero);
+        if (_mm_movemask_epi8(transparent) == 0xFFFF)
+            continue;
+
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_blendv_epi8(pixels, dest, transparent));
+    }
+    BlitRowTransparentScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift);
+}
+
+void BlitRowRemapSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; ((i + 16) << srcShift) <= srcLength; i += 16)
+    {
+        const __m128i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m128i transparent = _mm_cmpeq_epi8(pixels, zero);
+        if (_mm_movemask_epi8(transparent) == 0xFFFF)
+            continue;
+
+        const __m128i remapped = LookupPixels(pixels, lut);
+        const __m128i keep = _mm_or_si128(transparent, _mm_cmpeq_epi8(remapped, zero));
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_blendv_epi8(remapped, dest, keep));
+    }
+    BlitRowRemapScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift, lut);
+}
+
+void BlitRowRemapDstSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; ((i + 16) << srcShift) <= srcLength; i += 16)
+    {
+        const __m128i pixels = LoadSampledPixels(src + (i << srcShift), srcShift);
+        const __m128i transparent = _mm_cmpeq_epi8(pixels, zero);
+        if (_mm_movemask_epi8(transparent) == 0xFFFF)
+            continue;
+
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i remapped = LookupPixels(dest, lut);
+        const __m128i keep = _mm_or_si128(transparent, _mm_cmpeq_epi8(remapped, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_blendv_epi8(remapped, dest, keep));
+    }
+    BlitRowRemapDstScalar(src + (i << srcShift), dst + i, srcLength - (i << srcShift), srcShift, lut);
+}
+
+namespace OpenRCT2::Drawing
+{
+    int32_t FindClosestColourSse4_1(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
+    {
+        const __m128i colourR = _mm_set1_epi32(r);
+        const __m128i colourG = _mm_set1_epi32(g);
+        const __m128i colourB = _mm_set1_epi32(b);
+        const __m128i positionStep = _mm_set1_epi32(4);
+        __m128i position = _mm_setr_epi32(0, 1, 2, 3);
+        __m128i smallestErrors = _mm_set1_epi32(std::numeric_limits<int32_t>::max());
+        __m128i bestMatches = _mm_set1_epi32(-1);
+
+        int32_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i dr = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(red + i)), colourR);
+            const __m128i dg = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(green + i)), colourG);
+            const __m128i db = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blue + i)), colourB);
+            // _mm_mullo_epi32 and _mm_min_epi32 are SSE4.1
+            const __m128i error = _mm_add_epi32(
+                _mm_add_epi32(_mm_mullo_epi32(dr, dr), _mm_mullo_epi32(dg, dg)), _mm_mullo_epi32(db, db));
+
+            // Only a strictly smaller error replaces the match, so each lane keeps its first best colour
+            const __m128i smaller = _mm_cmplt_epi32(error, smallestErrors);
+            smallestErrors = _mm_min_epi32(error, smallestErrors);
+            bestMatches = _mm_blendv_epi8(bestMatches, position, smaller);
+            position = _mm_add_epi32(position, positionStep);
+        }
+
+        alignas(16) int32_t laneErrors[4];
+        alignas(16) int32_t laneMatches[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneErrors), smallestErrors);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneMatches), bestMatches);
+
+        // Ties between lanes go to the earlier colour, the colours after the last full vector come after all of them
+        auto smallestError = std::numeric_limits<int32_t>::max();
+        int32_t bestMatch = -1;
+        for (int32_t lane = 0; lane < 4; lane++)
+        {
+            if (laneErrors[lane] < smallestError || (laneErrors[lane] == smallestError && laneMatches[lane] < bestMatch))
+            {
+                smallestError = laneErrors[lane];
+                bestMatch = laneMatches[lane];
+            }
+        }
+        for (; i < count; i++)
+        {
+            const auto dr = red[i] - r;
+            const auto dg = green[i] - g;
+            const auto db = blue[i] - b;
+            const auto error = dr * dr + dg * dg + db * db;
+            if (error < smallestError)
+            {
+                bestMatch = i;
+                smallestError = error;
+            }
+        }
+        return bestMatch;
+    }
+} // namespace OpenRCT2::Drawing
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -68,4 +243,32 @@ void MaskSse4_1(
     OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void BlitRowTransparentSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void BlitRowRemapSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void BlitRowRemapDstSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcLength, int32_t srcShift, const uint8_t* RESTRICT lut)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+namespace OpenRCT2::Drawing
+{
+    int32_t FindClosestColourSse4_1(
+        const int32_t* RESTRICT red, const int32_t* RESTRICT green, const int32_t* RESTRICT blue, int32_t count, int32_t r,
+        int32_t g, int32_t b)
+    {
+        Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+        return -1;
+    }
+} // namespace OpenRCT2::Drawing
+
 #endif // __SSE4_1__
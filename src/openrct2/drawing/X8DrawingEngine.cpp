@@ -205,6 +205,7 @@ void X8DrawingEngine::EndDraw()
 void X8DrawingEngine::PaintWindows()
 {
     WindowResetVisibilities();
+    _dirtyStats = {};
 
     // Redraw dirty regions before updating the viewports, otherwise
     // when viewports get panned, they copy dirty pixels
@@ -278,6 +279,11 @@ DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
     return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
+DirtyRegionStats X8DrawingEngine::GetDirtyRegionStats()
+{
+    return _dirtyStats;
+}
+
 void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
 {
     // Not applicable for this engine
@@ -365,9 +371,9 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
-    // TODO: For optimal performance it is currently limited to a single column.
-    // The optimal approach would be to extract all dirty regions as rectangles not including
-    // parts that are not marked dirty and have the grid more fine grained.
+    // Each dirty run within a column is extended to the right over neighbouring columns that are dirty in exactly
+    // the same rows, so the run is drawn as one rectangle. Requiring an exact match means no block that is not
+    // dirty gets redrawn and no longer run in a neighbouring column gets split up.
     // A situation like following:
     //
     //   0 1 2 3 4 5 6 7 8 9
@@ -375,14 +381,8 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
     //   2 - x x x x - - - -
     //   3 - x x - - - - - -
     //   4 - - - - - - - - -
-    //   5 - - - - - - - - -
-    //   6 - - - - - - - - -
-    //   7 - - - - - - - - -
-    //   8 - - - - - - - - -
-    //   9 - - - - - - - - -
     //
-    // Would currently redraw {2,2} to {3,5} where {3,4} and {3,5} are not dirty. Choosing to do this
-    // per column eliminates this issue but limits it to rendering just a single column at a time.
+    // Is drawn as {1,2} to {2,3} followed by {3,2} to {4,2}.
 
     for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
     {
@@ -394,11 +394,16 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
                 continue;
             }
 
-            // See comment above as to why this is 1.
-            const uint32_t columns = 1;
-
             // Check rows
-            auto rows = GetNumDirtyRows(x, y, columns);
+            auto rows = GetNumDirtyRows(x, y, 1);
+
+            // Check columns
+            uint32_t columns = 1;
+            while (x + columns < _dirtyGrid.BlockColumns && IsDirtyRun(x + columns, y, rows))
+            {
+                columns++;
+            }
+
             DrawDirtyBlocks(x, y, columns, rows);
         }
     }
@@ -422,6 +427,27 @@ uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, co
     return yy - y;
 }
 
+bool X8DrawingEngine::IsDirtyRun(uint32_t x, uint32_t y, uint32_t rows) const
+{
+    // The run must not continue above or below, otherwise it would be split
+    if (y > 0 && _dirtyGrid.Blocks[(y - 1) * _dirtyGrid.BlockColumns + x] != 0)
+    {
+        return false;
+    }
+    if (y + rows < _dirtyGrid.BlockRows && _dirtyGrid.Blocks[(y + rows) * _dirtyGrid.BlockColumns + x] != 0)
+    {
+        return false;
+    }
+    for (uint32_t yy = y; yy < y + rows; yy++)
+    {
+        if (_dirtyGrid.Blocks[yy * _dirtyGrid.BlockColumns + x] == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
 {
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
@@ -447,6 +473,9 @@ void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns,
         return;
     }
 
+    _dirtyStats.RepaintedRects++;
+    _dirtyStats.RepaintedPixels += static_cast<uint64_t>(right - left) * (bottom - top);
+
     // Draw region
     OnDrawDirtyBlock(x, y, columns, rows);
     WindowDrawAll(_bitsDPI, left, top, right, bottom);
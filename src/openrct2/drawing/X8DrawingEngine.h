@@ -74,6 +74,7 @@ namespace OpenRCT2
             uint8_t* _bits = nullptr;
 
             DirtyGrid _dirtyGrid = {};
+            DirtyRegionStats _dirtyStats = {};
 
             DrawPixelInfo _bitsDPI = {};
 
@@ -110,6 +111,7 @@ namespace OpenRCT2
             DrawPixelInfo* GetDrawingPixelInfo() override;
             DRAWING_ENGINE_FLAGS GetFlags() override;
             void InvalidateImage(uint32_t image) override;
+            DirtyRegionStats GetDirtyRegionStats() override;
 
             DrawPixelInfo* GetDPI();
 
@@ -121,6 +123,7 @@ namespace OpenRCT2
             void ConfigureDirtyGrid();
             void DrawAllDirtyBlocks();
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
+            bool IsDirtyRun(uint32_t x, uint32_t y, uint32_t rows) const;
             void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
@@ -32,13 +32,10 @@ void EntityBase::SetLocation(const CoordsXYZ& newLocation)
     z = newLocation.z;
 }
 
-void EntityBase::Invalidate()
+static ZoomLevel GetInvalidateMaxZoom(EntityType type)
 {
-    if (x == kLocationNull)
-        return;
-
     ZoomLevel maxZoom{ 0 };
-    switch (Type)
+    switch (type)
     {
         case EntityType::Vehicle:
         case EntityType::Guest:
@@ -66,8 +63,35 @@ void EntityBase::Invalidate()
         default:
             break;
     }
+    return maxZoom;
+}
+
+void EntityBase::Invalidate()
+{
+    if (x == kLocationNull)
+        return;
+
+    ViewportsInvalidate(
+        GetLocation(), SpriteData.Width, SpriteData.HeightMin, SpriteData.HeightMax, GetInvalidateMaxZoom(Type));
+}
+
+void EntityBase::InvalidateMovement(const CoordsXYZ& oldLocation)
+{
+    if (oldLocation.x == kLocationNull)
+    {
+        Invalidate();
+        return;
+    }
+    if (x == kLocationNull || oldLocation == GetLocation())
+    {
+        ViewportsInvalidate(
+            oldLocation, SpriteData.Width, SpriteData.HeightMin, SpriteData.HeightMax, GetInvalidateMaxZoom(Type));
+        return;
+    }
 
-    ViewportsInvalidate(GetLocation(), SpriteData.Width, SpriteData.HeightMin, SpriteData.HeightMax, maxZoom);
+    ViewportsInvalidateMovement(
+        oldLocation, GetLocation(), SpriteData.Width, SpriteData.HeightMin, SpriteData.HeightMax,
+        GetInvalidateMaxZoom(Type));
 }
 
 void EntityBase::Serialise(DataSerialiser& stream)
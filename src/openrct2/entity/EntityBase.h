@@ -64,6 +64,12 @@ struct EntityBase
     CoordsXYZ GetLocation() const;
 
     void Invalidate();
+
+    /**
+     * Invalidates the area the entity moved from and the area it moved to, merging both into one region when they
+     * overlap so a small move does not dirty the screen twice.
+     */
+    void InvalidateMovement(const CoordsXYZ& oldLocation);
     template<typename T> bool Is() const;
     template<typename T> T* As()
     {
@@ -24,6 +24,13 @@ uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
 
+/**
+ * Gets the entities, in index order, whose sprite rectangles in the given rotation may overlap the given rectangle.
+ * The sprite rectangles still need to be checked. The index is rebuilt whenever it is asked for a different rotation
+ * than last time, so it should only be used for the rotation of the main viewport.
+ */
+std::vector<EntityId> GetEntityScreenList(const ScreenRect& rect, uint8_t rotation);
+
 template<typename T> class EntityTileIterator
 {
 private:
@@ -96,6 +103,27 @@ public:
     }
 };
 
+template<typename T = EntityBase> class EntityScreenList
+{
+private:
+    std::vector<EntityId> vec;
+
+public:
+    EntityScreenList(const ScreenRect& rect, uint8_t rotation)
+        : vec(GetEntityScreenList(rect, rotation))
+    {
+    }
+
+    EntityTileIterator<T> begin()
+    {
+        return EntityTileIterator<T>(std::begin(vec), std::end(vec));
+    }
+    EntityTileIterator<T> end()
+    {
+        return EntityTileIterator<T>(std::end(vec), std::end(vec));
+    }
+};
+
 template<typename T> class EntityListIterator
 {
 private:
@@ -30,13 +30,16 @@
 #include "Duck.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
+#include "GuestStatistics.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
 #include <cassert>
 #include <cmath>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -51,6 +54,18 @@ constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
 static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
 
+// Sprites are put in screen cells by the point their rectangle is drawn around, so a sprite that changes size stays in
+// its cell. The rectangle never reaches further than this from that point on any side, as the sprite extents are bytes.
+constexpr int32_t SCREEN_INDEX_MAX_SPRITE_EXTENT = std::numeric_limits<uint8_t>::max();
+constexpr int32_t SCREEN_INDEX_CELL_SHIFT = 8;
+constexpr uint32_t SCREEN_INDEX_CELL_NULL = std::numeric_limits<uint32_t>::max();
+
+// The cells hold the sprite rectangles in one rotation, worked out from the entity positions rather than taken from
+// SpriteRect, which is left as it was for entities that have not moved since the view was rotated.
+static std::unordered_map<uint32_t, std::vector<EntityId>> _entityScreenIndex;
+static std::array<uint32_t, MAX_ENTITIES> _entityScreenCells;
+static uint8_t _entityScreenIndexRotation;
+
 static void FreeEntity(EntityBase& entity);
 
 static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
@@ -124,6 +139,41 @@ const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
     return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
 }
 
+static constexpr uint32_t GetScreenIndexCell(int32_t cellX, int32_t cellY)
+{
+    // Biased so that cells left of and above the origin do not collide with the null cell
+    const auto biasedX = static_cast<uint16_t>(cellX + 0x8000);
+    const auto biasedY = static_cast<uint16_t>(cellY + 0x8000);
+    return (static_cast<uint32_t>(biasedX) << 16) | biasedY;
+}
+
+static void ResetEntityScreenIndex(uint8_t rotation);
+
+std::vector<EntityId> GetEntityScreenList(const ScreenRect& rect, uint8_t rotation)
+{
+    if (rotation != _entityScreenIndexRotation)
+        ResetEntityScreenIndex(rotation);
+
+    std::vector<EntityId> result;
+    const auto firstCellX = (rect.GetLeft() - SCREEN_INDEX_MAX_SPRITE_EXTENT) >> SCREEN_INDEX_CELL_SHIFT;
+    const auto firstCellY = (rect.GetTop() - SCREEN_INDEX_MAX_SPRITE_EXTENT) >> SCREEN_INDEX_CELL_SHIFT;
+    const auto lastCellX = (rect.GetRight() + SCREEN_INDEX_MAX_SPRITE_EXTENT) >> SCREEN_INDEX_CELL_SHIFT;
+    const auto lastCellY = (rect.GetBottom() + SCREEN_INDEX_MAX_SPRITE_EXTENT) >> SCREEN_INDEX_CELL_SHIFT;
+    for (auto cellY = firstCellY; cellY <= lastCellY; cellY++)
+    {
+        for (auto cellX = firstCellX; cellX <= lastCellX; cellX++)
+        {
+            auto it = _entityScreenIndex.find(GetScreenIndexCell(cellX, cellY));
+            if (it != _entityScreenIndex.end())
+                result.insert(result.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    // Same order as the entity lists
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 static void ResetEntityLists()
 {
     for (auto& list : gEntityLists)
@@ -186,9 +236,24 @@ void ResetAllEntities()
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    OpenRCT2::GuestStatistics::Invalidate();
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
+static void EntityScreenMove(const EntityBase& entity);
+
+static void ResetEntityScreenIndex(uint8_t rotation)
+{
+    _entityScreenIndex.clear();
+    _entityScreenCells.fill(SCREEN_INDEX_CELL_NULL);
+    _entityScreenIndexRotation = rotation;
+    for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
+    {
+        auto* spr = GetEntity(EntityId::FromUnderlying(i));
+        if (spr != nullptr && spr->Type != EntityType::Null && spr->x != kLocationNull)
+            EntityScreenMove(*spr);
+    }
+}
 
 /**
  *
@@ -210,6 +275,7 @@ void ResetEntitySpatialIndices()
             EntitySpatialInsert(spr, { spr->x, spr->y });
         }
     }
+    ResetEntityScreenIndex(_entityScreenIndexRotation);
 }
 
 #ifndef DISABLE_NETWORK
@@ -368,6 +434,11 @@ EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
     _freeIdList.erase(std::next(id).base());
 
     PrepareNewEntity(entity, type);
+    if (type == EntityType::Guest)
+    {
+        // The caller fills in the guest state itself
+        OpenRCT2::GuestStatistics::Invalidate();
+    }
     return entity;
 }
 
@@ -438,13 +509,39 @@ static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
     EntitySpatialInsert(entity, newLoc);
 }
 
-void EntityBase::MoveTo(const CoordsXYZ& newLocation)
+static void EntityScreenRemove(const EntityBase& entity)
 {
-    if (x != kLocationNull)
+    auto& cell = _entityScreenCells[entity.Id.ToUnderlying()];
+    if (cell == SCREEN_INDEX_CELL_NULL)
+        return;
+
+    auto& screenVector = _entityScreenIndex[cell];
+    auto index = BinaryFind(std::begin(screenVector), std::end(screenVector), entity.Id);
+    if (index != std::end(screenVector))
     {
-        // Invalidate old position.
-        Invalidate();
+        screenVector.erase(index);
     }
+    cell = SCREEN_INDEX_CELL_NULL;
+}
+
+// Keeps the screen index in step with the entity position, which only moves it into another cell every so often
+static void EntityScreenMove(const EntityBase& entity)
+{
+    const auto screenCoords = Translate3DTo2DWithZ(_entityScreenIndexRotation, entity.GetLocation());
+    const auto newCell = GetScreenIndexCell(
+        screenCoords.x >> SCREEN_INDEX_CELL_SHIFT, screenCoords.y >> SCREEN_INDEX_CELL_SHIFT);
+    if (_entityScreenCells[entity.Id.ToUnderlying()] == newCell)
+        return;
+
+    EntityScreenRemove(entity);
+    auto& screenVector = _entityScreenIndex[newCell];
+    screenVector.insert(std::lower_bound(std::begin(screenVector), std::end(screenVector), entity.Id), entity.Id);
+    _entityScreenCells[entity.Id.ToUnderlying()] = newCell;
+}
+
+void EntityBase::MoveTo(const CoordsXYZ& newLocation)
+{
+    const auto oldLocation = GetLocation();
 
     auto loc = newLocation;
     if (!MapIsLocationValid(loc))
@@ -459,12 +556,15 @@ void EntityBase::MoveTo(const CoordsXYZ& newLocation)
         x = loc.x;
         y = loc.y;
         z = loc.z;
+        EntityScreenRemove(*this);
     }
     else
     {
         EntitySetCoordinates(loc, this);
-        Invalidate(); // Invalidate new position.
     }
+
+    // Invalidate old and new position together.
+    InvalidateMovement(oldLocation);
 }
 
 void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity)
@@ -475,6 +575,7 @@ void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity)
         screenCoords - ScreenCoordsXY{ entity->SpriteData.Width, entity->SpriteData.HeightMin },
         screenCoords + ScreenCoordsXY{ entity->SpriteData.Width, entity->SpriteData.HeightMax });
     entity->SetLocation(entityPos);
+    EntityScreenMove(*entity);
 }
 
 /**
@@ -494,6 +595,7 @@ static void FreeEntity(EntityBase& entity)
         guest->SetName({});
         OpenRCT2::RideUse::GetHistory().RemoveHandle(guest->Id);
         OpenRCT2::RideUse::GetTypeHistory().RemoveHandle(guest->Id);
+        OpenRCT2::GuestStatistics::RemoveGuest(*guest);
     }
 }
 
@@ -510,6 +612,7 @@ void EntityRemove(EntityBase* entity)
     AddToFreeList(entity->Id);
 
     EntitySpatialRemove(entity);
+    EntityScreenRemove(*entity);
     EntityReset(entity);
 }
 
@@ -22,6 +22,7 @@
 #include "../core/String.hpp"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestStatistics.h"
 #include "../entity/MoneyEffect.h"
 #include "../entity/Particle.h"
 #include "../interface/Window_internal.h"
@@ -725,6 +726,7 @@ void Guest::HandleEasterEggName()
     {
         PeepFlags |= PEEP_FLAGS_HERE_WE_ARE;
     }
+    GuestStatistics::UpdateGuest(*this);
 }
 
 /**
@@ -1895,27 +1897,18 @@ OpenRCT2::BitSet<OpenRCT2::Limits::kMaxRidesInPark> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = Floor2(x, 32);
-        int32_t cy = Floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += kCoordsXYStep)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += kCoordsXYStep)
+        constexpr auto radius = 10;
+        const TileCoordsXY centre{ Floor2(x, kCoordsXYStep) / kCoordsXYStep, Floor2(y, kCoordsXYStep) / kCoordsXYStep };
+        const TileCoordsXY min{ std::max(centre.x - radius, 0), std::max(centre.y - radius, 0) };
+        const TileCoordsXY max{ std::min(centre.x + radius, kMaximumMapSizeTechnical - 1),
+                                std::min(centre.y + radius, kMaximumMapSizeTechnical - 1) };
+        ForEachTileElementInRange<TrackElement>(min, max, [&](const TileCoordsXY&, const TrackElement* trackElement) {
+            auto rideIndex = trackElement->GetRideIndex();
+            if (!rideIndex.IsNull())
             {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!MapIsLocationValid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    if (!rideIndex.IsNull())
-                    {
-                        rideConsideration[rideIndex.ToUnderlying()] = true;
-                    }
-                }
+                rideConsideration[rideIndex.ToUnderlying()] = true;
             }
-        }
+        });
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         for (auto& ride : GetRideManager())
@@ -7004,6 +6997,7 @@ void Guest::InsertNewThought(PeepThoughtType thoughtType, uint16_t thoughtArgume
     thought.fresh_timeout = 0;
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    GuestStatistics::UpdateGuest(*this);
 }
 
 // clang-format off
@@ -7293,6 +7287,7 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     }
 #endif
 
+    GuestStatistics::UpdateGuest(*peep);
     return peep;
 }
 
@@ -7645,6 +7640,7 @@ void Guest::RemoveRideFromMemory(RideId rideId)
         lastEntry.type = PeepThoughtType::None;
         lastEntry.item = PeepThoughtItemNone;
     }
+    GuestStatistics::UpdateGuest(*this);
 }
 
 void Guest::Serialise(DataSerialiser& stream)
@@ -319,6 +319,9 @@ public:
     RideId FavouriteRide;
     uint8_t FavouriteRideRating;
     uint64_t ItemFlags;
+    // What the guest currently adds to the park wide GuestStatistics, not saved
+    uint8_t StatisticsFlags;
+    PeepThoughtType StatisticsThought;
 
     void UpdateGuest();
     void Tick128UpdateGuest(uint32_t index);
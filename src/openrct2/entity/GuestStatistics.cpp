@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestStatistics.h"
+
+#include "../Diagnostic.h"
+#include "../core/Guard.hpp"
+#include "../profiling/Profiling.h"
+#include "EntityList.h"
+
+namespace OpenRCT2
+{
+    namespace
+    {
+        enum : uint8_t
+        {
+            kStatisticsInPark = 1 << 0,
+            kStatisticsHappy = 1 << 1,
+            kStatisticsLost = 1 << 2,
+            kStatisticsFreshThought = 1 << 3,
+        };
+    } // namespace
+
+    static GuestStatistics _statistics;
+    static bool _statisticsValid;
+
+    static uint8_t GetStatisticsFlags(const Guest& guest)
+    {
+        if (guest.OutsideOfPark)
+            return 0;
+
+        uint8_t flags = kStatisticsInPark;
+        if (guest.Happiness > 128)
+        {
+            flags |= kStatisticsHappy;
+        }
+        if ((guest.PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (guest.GuestIsLostCountdown < 90))
+        {
+            flags |= kStatisticsLost;
+        }
+        if (std::get<0>(guest.Thoughts).freshness <= 5)
+        {
+            flags |= kStatisticsFreshThought;
+        }
+        return flags;
+    }
+
+    static void AddToStatistics(GuestStatistics& stats, uint8_t flags, PeepThoughtType thought, int32_t amount)
+    {
+        if (flags & kStatisticsInPark)
+            stats.GuestsInPark += amount;
+        if (flags & kStatisticsHappy)
+            stats.HappyGuests += amount;
+        if (flags & kStatisticsLost)
+            stats.LostGuests += amount;
+        if (flags & kStatisticsFreshThought)
+            stats.FreshThoughts[EnumValue(thought)] += amount;
+    }
+
+    static void RebuildStatistics()
+    {
+        _statistics = {};
+        for (auto peep : EntityList<Guest>())
+        {
+            peep->StatisticsFlags = GetStatisticsFlags(*peep);
+            peep->StatisticsThought = std::get<0>(peep->Thoughts).type;
+            AddToStatistics(_statistics, peep->StatisticsFlags, peep->StatisticsThought, 1);
+        }
+        _statisticsValid = true;
+    }
+
+    const GuestStatistics& GuestStatistics::Get()
+    {
+        if (!_statisticsValid)
+        {
+            RebuildStatistics();
+        }
+#if DEBUG_LEVEL_1
+        Guard::Assert(_statistics == Calculate(), "Guest statistics differ from a full recount of the guests");
+#endif
+        return _statistics;
+    }
+
+    GuestStatistics GuestStatistics::Calculate()
+    {
+        PROFILED_FUNCTION();
+
+        GuestStatistics stats;
+        for (auto peep : EntityList<Guest>())
+        {
+            AddToStatistics(stats, GetStatisticsFlags(*peep), std::get<0>(peep->Thoughts).type, 1);
+        }
+        return stats;
+    }
+
+    void GuestStatistics::UpdateGuest(Guest& guest)
+    {
+        if (!_statisticsValid)
+            return;
+
+        const auto flags = GetStatisticsFlags(guest);
+        const auto thought = std::get<0>(guest.Thoughts).type;
+        if (flags == guest.StatisticsFlags && thought == guest.StatisticsThought)
+            return;
+
+        AddToStatistics(_statistics, guest.StatisticsFlags, guest.StatisticsThought, -1);
+        AddToStatistics(_statistics, flags, thought, 1);
+        guest.StatisticsFlags = flags;
+        guest.StatisticsThought = thought;
+    }
+
+    void GuestStatistics::RemoveGuest(Guest& guest)
+    {
+        if (!_statisticsValid)
+            return;
+
+        AddToStatistics(_statistics, guest.StatisticsFlags, guest.StatisticsThought, -1);
+        guest.StatisticsFlags = 0;
+    }
+
+    void GuestStatistics::Invalidate()
+    {
+        _statisticsValid = false;
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../util/Util.h"
+#include "Guest.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace OpenRCT2
+{
+    /**
+     * Park wide counts over every guest inside the park. The counts are kept up to date as guests change so the park
+     * rating and award checks can read them without walking all guests.
+     */
+    struct GuestStatistics
+    {
+        uint32_t GuestsInPark{};
+        // Guests with a happiness above 128
+        uint32_t HappyGuests{};
+        // Guests trying to leave the park that have been unable to find the exit for a while
+        uint32_t LostGuests{};
+        // Guests whose most recent thought is still fresh, indexed by the type of that thought
+        std::array<uint32_t, std::numeric_limits<std::underlying_type_t<PeepThoughtType>>::max() + 1> FreshThoughts{};
+
+        template<typename... TThoughts> uint32_t GetFreshThoughtCount(TThoughts... types) const
+        {
+            return (FreshThoughts[EnumValue(types)] + ...);
+        }
+
+        bool operator==(const GuestStatistics&) const = default;
+
+        /**
+         * Returns the counts kept up to date by UpdateGuest and RemoveGuest, counting all guests again first if they
+         * were invalidated. Debug builds check the counts against Calculate.
+         */
+        static const GuestStatistics& Get();
+
+        /**
+         * Counts every guest in a single pass over the guest list.
+         */
+        static GuestStatistics Calculate();
+
+        /**
+         * Replaces what the guest is counted as with its current state. Has to be called after changing the happiness,
+         * thoughts, lost countdown, leaving park flag or park presence of a guest.
+         */
+        static void UpdateGuest(Guest& guest);
+
+        static void RemoveGuest(Guest& guest);
+
+        /**
+         * Makes the next Get count all guests again, for when guests are created or replaced without going through
+         * UpdateGuest such as when loading a park.
+         */
+        static void Invalidate();
+    };
+} // namespace OpenRCT2
@@ -26,6 +26,7 @@
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/GuestStatistics.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatter.h"
@@ -220,6 +221,12 @@ void PeepUpdateAll()
             peep->Update();
         }
 
+        // The update can delete the guest as well
+        if (peep->Type == EntityType::Guest)
+        {
+            GuestStatistics::UpdateGuest(*peep);
+        }
+
         index++;
     }
 
@@ -1307,7 +1314,9 @@ void PeepUpdateCrowdNoise()
     // Count the number of peeps visible
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
+    const ScreenRect viewRect = { viewport->viewPos,
+                                  viewport->viewPos + ScreenCoordsXY{ viewport->view_width, viewport->view_height } };
+    for (auto peep : EntityScreenList<Guest>(viewRect, viewport->rotation))
     {
         if (peep->x == kLocationNull)
             continue;
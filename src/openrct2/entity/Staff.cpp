@@ -32,6 +32,7 @@
 #include "../object/TerrainSurfaceObject.h"
 #include "../paint/tile_element/Paint.TileElement.h"
 #include "../peep/GuestPathfinding.h"
+#include "../peep/PathDistanceField.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -47,8 +48,10 @@
 #include "PatrolArea.h"
 #include "Peep.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
+#include <limits>
 
 using namespace OpenRCT2;
 
@@ -329,22 +332,71 @@ bool Staff::HasPatrolArea() const
  *
  * Returns INVALID_DIRECTION when no nearby litter or unpathable litter
  */
-Direction Staff::HandymanDirectionToNearestLitter() const
+static uint16_t GetLitterDistance(const Litter& litter, const CoordsXYZ& loc)
+{
+    return abs(litter.x - loc.x) + abs(litter.y - loc.y) + abs(litter.z - loc.z) * 4;
+}
+
+/**
+ * Finds the litter with the lowest distance to loc, the lowest entity id winning ties, or nullptr if there is none
+ * within MAX_LITTER_DISTANCE.
+ */
+static Litter* FindNearestLitter(const CoordsXYZ& loc)
 {
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
 
-        if (distance < nearestLitterDist)
+    // Distances are truncated to 16 bits, so on very large maps litter on the far side of the map can wrap around to
+    // a small distance. Only look at the tiles around loc when that cannot happen.
+    const auto mapSize = GetMapSizeUnits();
+    constexpr int32_t kMaxDistanceZ = MAX_ELEMENT_HEIGHT * kCoordsZStep * 4;
+    if (mapSize.x + mapSize.y + kMaxDistanceZ > std::numeric_limits<uint16_t>::max())
+    {
+        // Entity lists are in id order
+        for (auto litter : EntityList<Litter>())
+        {
+            auto distance = GetLitterDistance(*litter, loc);
+            if (distance < nearestLitterDist)
+            {
+                nearestLitterDist = distance;
+                nearestLitter = litter;
+            }
+        }
+    }
+    else
+    {
+        const auto tileMin = TileCoordsXY{ CoordsXY{ std::max(loc.x - MAX_LITTER_DISTANCE, 0),
+                                                     std::max(loc.y - MAX_LITTER_DISTANCE, 0) } };
+        const auto tileMax = TileCoordsXY{ CoordsXY{ loc.x + MAX_LITTER_DISTANCE, loc.y + MAX_LITTER_DISTANCE } };
+        for (int32_t tileY = tileMin.y; tileY <= std::min<int32_t>(tileMax.y, kMaximumMapSizeTechnical - 1); tileY++)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            for (int32_t tileX = tileMin.x; tileX <= std::min<int32_t>(tileMax.x, kMaximumMapSizeTechnical - 1); tileX++)
+            {
+                for (auto litter : EntityTileList<Litter>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+                {
+                    auto distance = GetLitterDistance(*litter, loc);
+                    if (distance < nearestLitterDist
+                        || (distance == nearestLitterDist && nearestLitter != nullptr && litter->Id < nearestLitter->Id))
+                    {
+                        nearestLitterDist = distance;
+                        nearestLitter = litter;
+                    }
+                }
+            }
         }
     }
 
     if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    {
+        return nullptr;
+    }
+    return nearestLitter;
+}
+
+Direction Staff::HandymanDirectionToNearestLitter() const
+{
+    auto* nearestLitter = FindNearestLitter(GetLocation());
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
@@ -713,6 +765,14 @@ Direction Staff::MechanicDirectionPath(uint8_t validDirections, PathElement* pat
             }
         }
 
+        // Follow the distances to the station exit where the mechanic is on a path connected to it
+        Direction fieldDirection = PathFinding::ChooseStationExitDirection(
+            *ride, CurrentRideStation, *this, TileCoordsXYZ{ NextLoc }, pathDirections);
+        if (fieldDirection != INVALID_DIRECTION)
+        {
+            return fieldDirection;
+        }
+
         gPeepPathFindIgnoreForeignQueues = false;
         gPeepPathFindQueueRideIndex = RideId::GetNull();
 
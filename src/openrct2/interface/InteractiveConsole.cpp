@@ -59,6 +59,7 @@
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "Viewport.h"
@@ -736,6 +737,14 @@ static int32_t ConsoleCommandGet(InteractiveConsole& console, const arguments_t&
         {
             console.WriteFormatLine("host_timescale %.02f", OpenRCT2::GetContext()->GetTimeScale());
         }
+        else if (argv[0] == "map_maintenance")
+        {
+            const auto& stats = MapGetMaintenanceStats();
+            console.WriteFormatLine(
+                "map_maintenance %u us, %u grass/scenery tiles, %u wide path tiles updated, %u skipped, %u regions scanned",
+                stats.ElapsedMicroseconds, stats.GrassSceneryTiles, stats.WidePathTilesUpdated, stats.WidePathTilesSkipped,
+                stats.WidePathRegionsScanned);
+        }
 #ifndef NO_TTF
         else if (argv[0] == "enable_hinting")
         {
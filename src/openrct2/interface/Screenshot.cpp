@@ -21,6 +21,7 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
@@ -38,6 +39,7 @@
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
@@ -227,34 +229,6 @@ static int32_t GetTallestVisibleTileTop(
     return minViewY - 64;
 }
 
-static DrawPixelInfo CreateDPI(const Viewport& viewport)
-{
-    DrawPixelInfo dpi;
-    dpi.width = viewport.width;
-    dpi.height = viewport.height;
-    dpi.bits = new (std::nothrow) uint8_t[dpi.width * dpi.height];
-    if (dpi.bits == nullptr)
-    {
-        throw std::runtime_error("Giant screenshot failed, unable to allocate memory for image.");
-    }
-
-    if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
-    {
-        std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
-    }
-
-    return dpi;
-}
-
-static void ReleaseDPI(DrawPixelInfo& dpi)
-{
-    if (dpi.bits != nullptr)
-        delete[] dpi.bits;
-    dpi.bits = nullptr;
-    dpi.width = 0;
-    dpi.height = 0;
-}
-
 static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
 {
     auto& gameState = GetGameState();
@@ -307,24 +281,88 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
+/**
+ * Renders the viewport in horizontal bands and streams each finished band to the PNG encoder, which runs on
+ * its own thread while the next band is painted. Only two bands are ever held in memory, regardless of the
+ * viewport size. Each band is still painted in parallel columns by ViewportPaint.
+ */
+static void RenderViewportToFile(const Viewport& viewport, std::string_view path)
 {
+    constexpr int32_t kBandHeight = 512;
+
+    if (viewport.width <= 0 || viewport.height <= 0)
+    {
+        throw std::runtime_error("Screenshot failed, the view is empty.");
+    }
+
     // Ensure sprites appear regardless of rotation
     ResetAllSpriteQuadrantPlacements();
 
-    std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
-    if (drawingEngine == nullptr)
+    auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+
+    const auto bandHeight = std::min(kBandHeight, viewport.height);
+    const auto bandSize = static_cast<size_t>(viewport.width) * bandHeight;
+    std::vector<uint8_t> bands[2];
+    try
     {
-        tempDrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
-        drawingEngine = tempDrawingEngine.get();
+        bands[0].resize(bandSize);
+        bands[1].resize(bandSize);
     }
-    dpi.DrawingEngine = drawingEngine;
-    ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
+    catch (const std::bad_alloc&)
+    {
+        throw std::runtime_error("Screenshot failed, unable to allocate memory for image.");
+    }
+
+    Imaging::PngWriter writer(path, viewport.width, viewport.height, 8, &gPalette);
+    JobPool encoder(1);
+    std::exception_ptr encodeError;
+
+    int32_t bandIndex = 0;
+    for (int32_t top = 0; top < viewport.height; top += bandHeight, bandIndex++)
+    {
+        const auto height = std::min(bandHeight, viewport.height - top);
+        auto& band = bands[bandIndex % 2];
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+        {
+            std::fill_n(band.data(), static_cast<size_t>(viewport.width) * height, PALETTE_INDEX_0);
+        }
+
+        DrawPixelInfo dpi;
+        dpi.DrawingEngine = drawingEngine.get();
+        dpi.bits = band.data();
+        dpi.y = top;
+        dpi.width = viewport.width;
+        dpi.height = height;
+        ViewportRender(dpi, &viewport, { { 0, top }, { viewport.width, top + height } });
+
+        // The previous band must be fully encoded before this one is queued, and before its buffer is reused.
+        encoder.Join();
+        if (encodeError != nullptr)
+        {
+            std::rethrow_exception(encodeError);
+        }
+        encoder.AddTask([&writer, &band, &encodeError, width = viewport.width, height]() {
+            try
+            {
+                writer.WriteRows(band.data(), width, height);
+            }
+            catch (...)
+            {
+                encodeError = std::current_exception();
+            }
+        });
+    }
+
+    encoder.Join();
+    if (encodeError != nullptr)
+    {
+        std::rethrow_exception(encodeError);
+    }
+    writer.Finish();
 }
 
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -352,10 +390,7 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        RenderViewportToFile(viewport, path.value());
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -369,8 +404,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, STR_NONE, {}, true);
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -443,7 +476,6 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     }
 
     int32_t exitCode = 1;
-    DrawPixelInfo dpi;
     try
     {
         bool customLocation = false;
@@ -545,17 +577,13 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
+        RenderViewportToFile(viewport, outputPath);
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     DrawingEngineDispose();
 
@@ -640,8 +668,5 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, dpi, gPalette);
-    ReleaseDPI(dpi);
+    RenderViewportToFile(viewport, outputPath);
 }
@@ -42,6 +42,7 @@
 #include "Window.h"
 #include "Window_internal.h"
 
+#include <algorithm>
 #include <cstring>
 #include <list>
 #include <unordered_map>
@@ -279,6 +280,41 @@ void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight,
     }
 }
 
+void ViewportsInvalidateMovement(
+    const CoordsXYZ& oldPos, const CoordsXYZ& newPos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom)
+{
+    for (auto& vp : _viewports)
+    {
+        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
+        {
+            auto oldCoords = Translate3DTo2DWithZ(vp.rotation, oldPos);
+            auto newCoords = Translate3DTo2DWithZ(vp.rotation, newPos);
+            auto oldRect = ScreenRect(
+                oldCoords - ScreenCoordsXY{ width, minHeight }, oldCoords + ScreenCoordsXY{ width, maxHeight });
+            auto newRect = ScreenRect(
+                newCoords - ScreenCoordsXY{ width, minHeight }, newCoords + ScreenCoordsXY{ width, maxHeight });
+
+            // Most moves are a few pixels, so the old and new rectangles overlap and one invalidation covers both.
+            // Only merge when the bounding rectangle is no larger than the two rectangles on their own.
+            auto unionRect = ScreenRect(
+                std::min(oldRect.GetLeft(), newRect.GetLeft()), std::min(oldRect.GetTop(), newRect.GetTop()),
+                std::max(oldRect.GetRight(), newRect.GetRight()), std::max(oldRect.GetBottom(), newRect.GetBottom()));
+            auto area = [](const ScreenRect& rect) {
+                return static_cast<int64_t>(rect.GetWidth()) * rect.GetHeight();
+            };
+            if (area(unionRect) <= area(oldRect) + area(newRect))
+            {
+                ViewportInvalidate(&vp, unionRect);
+            }
+            else
+            {
+                ViewportInvalidate(&vp, oldRect);
+                ViewportInvalidate(&vp, newRect);
+            }
+        }
+    }
+}
+
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
 {
     for (auto& vp : _viewports)
@@ -11,8 +11,12 @@
 
 #include "../Context.h"
 #include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Memory.hpp"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
 #include "../core/RTL.h"
 #include "../core/String.hpp"
 #include "../core/StringBuilder.h"
@@ -21,6 +25,8 @@
 #include "LocalisationService.h"
 #include "StringIds.h"
 
+#include <limits>
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -34,19 +40,34 @@ constexpr uint64_t MAX_SCENARIO_OVERRIDES = 4096;
 constexpr StringId ScenarioOverrideBase = 0x7000;
 constexpr int32_t ScenarioOverrideMaxStringCount = 3;
 
+// Offset of a string that is not set
+constexpr uint32_t kNoString = std::numeric_limits<uint32_t>::max();
+
+// Compiled language packs, see LanguagePack::Compile
+constexpr uint32_t kCompiledMagicNumber = 0x4B43504C; // LPCK
+constexpr uint16_t kCompiledVersion = 1;
+
 struct ScenarioOverride
 {
-    std::string filename;
-    std::string strings[ScenarioOverrideMaxStringCount];
+    uint32_t filename = kNoString;
+    uint32_t strings[ScenarioOverrideMaxStringCount] = { kNoString, kNoString, kNoString };
 };
+static_assert(sizeof(ScenarioOverride) == 16, "Compiled language packs store scenario overrides as they are");
 
 class LanguagePack final : public ILanguagePack
 {
 private:
     uint16_t const _id;
-    std::vector<std::string> _strings;
+
+    // All strings one after another, each null terminated, the other members refer to them by offset
+    std::vector<utf8> _pool;
+    std::vector<uint32_t> _offsets;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
+    // The strings by id, pointing into the pool or to one of the strings that were set afterwards
+    std::vector<const utf8*> _strings;
+    std::list<std::string> _setStrings;
+
     ///////////////////////////////////////////////////////////////////////////
     // Parsing work data
     ///////////////////////////////////////////////////////////////////////////
@@ -84,24 +105,103 @@ public:
     }
 
     static std::unique_ptr<LanguagePack> FromText(uint16_t id, const utf8* text)
-    {
-        return std::make_unique<LanguagePack>(id, text);
-    }
-
-    LanguagePack(uint16_t id, const utf8* text)
-        : _id(id)
     {
         Guard::ArgumentNotNull(text);
 
+        auto languagePack = std::make_unique<LanguagePack>(id);
         auto reader = UTF8StringReader(text);
         while (reader.CanRead())
         {
-            ParseLine(&reader);
+            languagePack->ParseLine(&reader);
         }
 
         // Clean up the parsing work data
-        _currentGroup.clear();
-        _currentScenarioOverride = nullptr;
+        languagePack->_currentGroup.clear();
+        languagePack->_currentScenarioOverride = nullptr;
+
+        languagePack->ResolveStrings();
+        return languagePack;
+    }
+
+    /**
+     * Reads a language pack written by Compile, returns nullptr if the data is not a valid compiled language pack
+     * for the given language.
+     */
+    static std::unique_ptr<LanguagePack> FromCompiled(
+        uint16_t id, const std::vector<uint8_t>& data, uint64_t& sourceSize, uint64_t& sourceLastModified)
+    {
+        try
+        {
+            MemoryStream stream(data.data(), data.size());
+            if (stream.ReadValue<uint32_t>() != kCompiledMagicNumber || stream.ReadValue<uint16_t>() != kCompiledVersion
+                || stream.ReadValue<uint16_t>() != id)
+            {
+                return nullptr;
+            }
+
+            sourceSize = stream.ReadValue<uint64_t>();
+            sourceLastModified = stream.ReadValue<uint64_t>();
+            const auto numStrings = stream.ReadValue<uint32_t>();
+            const auto numScenarioOverrides = stream.ReadValue<uint32_t>();
+            const auto poolSize = stream.ReadValue<uint32_t>();
+
+            const uint64_t remainingSize = stream.GetLength() - stream.GetPosition();
+            const uint64_t expectedSize = (static_cast<uint64_t>(numStrings) * sizeof(uint32_t))
+                + (static_cast<uint64_t>(numScenarioOverrides) * sizeof(ScenarioOverride)) + poolSize;
+            if (remainingSize != expectedSize)
+            {
+                return nullptr;
+            }
+
+            auto languagePack = std::make_unique<LanguagePack>(id);
+            languagePack->_offsets.resize(numStrings);
+            stream.Read(languagePack->_offsets.data(), numStrings * sizeof(uint32_t));
+            languagePack->_scenarioOverrides.resize(numScenarioOverrides);
+            stream.Read(languagePack->_scenarioOverrides.data(), numScenarioOverrides * sizeof(ScenarioOverride));
+            languagePack->_pool.resize(poolSize);
+            stream.Read(languagePack->_pool.data(), poolSize);
+
+            if (!languagePack->IsValid())
+            {
+                return nullptr;
+            }
+            languagePack->ResolveStrings();
+            return languagePack;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to read compiled language pack: %s", e.what());
+            return nullptr;
+        }
+    }
+
+    explicit LanguagePack(uint16_t id)
+        : _id(id)
+    {
+    }
+
+    /**
+     * Writes the strings as they were read into a single block that FromCompiled can load without parsing anything.
+     * The size and last modified time of the file the strings were read from are stored so that a stale block can be
+     * told apart.
+     */
+    std::vector<uint8_t> Compile(uint64_t sourceSize, uint64_t sourceLastModified) const
+    {
+        MemoryStream stream;
+        stream.WriteValue(kCompiledMagicNumber);
+        stream.WriteValue(kCompiledVersion);
+        stream.WriteValue(_id);
+        stream.WriteValue(sourceSize);
+        stream.WriteValue(sourceLastModified);
+        stream.WriteValue(static_cast<uint32_t>(_offsets.size()));
+        stream.WriteValue(static_cast<uint32_t>(_scenarioOverrides.size()));
+        stream.WriteValue(static_cast<uint32_t>(_pool.size()));
+        stream.Write(_offsets.data(), _offsets.size() * sizeof(uint32_t));
+        stream.Write(_scenarioOverrides.data(), _scenarioOverrides.size() * sizeof(ScenarioOverride));
+        stream.Write(_pool.data(), _pool.size());
+
+        const auto* data = static_cast<const uint8_t*>(stream.GetData());
+        return std::vector<uint8_t>(data, data + stream.GetLength());
     }
 
     uint16_t GetId() const override
@@ -118,7 +218,7 @@ public:
     {
         if (_strings.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId].clear();
+            _strings[stringId] = nullptr;
         }
     }
 
@@ -126,7 +226,15 @@ public:
     {
         if (_strings.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = str;
+            if (str.empty())
+            {
+                _strings[stringId] = nullptr;
+            }
+            else
+            {
+                // The pool can not grow as the strings already returned point into it
+                _strings[stringId] = _setStrings.emplace_back(str).c_str();
+            }
         }
     }
 
@@ -138,18 +246,17 @@ public:
             int32_t ooIndex = offset / ScenarioOverrideMaxStringCount;
             int32_t ooStringIndex = offset % ScenarioOverrideMaxStringCount;
 
-            if (_scenarioOverrides.size() > static_cast<size_t>(ooIndex)
-                && !_scenarioOverrides[ooIndex].strings[ooStringIndex].empty())
+            if (_scenarioOverrides.size() > static_cast<size_t>(ooIndex))
             {
-                return _scenarioOverrides[ooIndex].strings[ooStringIndex].c_str();
+                return GetPoolString(_scenarioOverrides[ooIndex].strings[ooStringIndex]);
             }
 
             return nullptr;
         }
 
-        if ((_strings.size() > static_cast<size_t>(stringId)) && !_strings[stringId].empty())
+        if (_strings.size() > static_cast<size_t>(stringId))
         {
-            return _strings[stringId].c_str();
+            return _strings[stringId];
         }
 
         return nullptr;
@@ -163,9 +270,9 @@ public:
         int32_t ooIndex = 0;
         for (const ScenarioOverride& scenarioOverride : _scenarioOverrides)
         {
-            if (String::IEquals(scenarioOverride.filename, scenarioFilename))
+            if (String::IEquals(GetPoolString(scenarioOverride.filename), scenarioFilename))
             {
-                if (scenarioOverride.strings[index].empty())
+                if (scenarioOverride.strings[index] == kNoString)
                 {
                     return STR_NONE;
                 }
@@ -178,11 +285,75 @@ public:
     }
 
 private:
+    const utf8* GetPoolString(uint32_t offset) const
+    {
+        if (offset == kNoString)
+        {
+            return nullptr;
+        }
+        return _pool.data() + offset;
+    }
+
+    uint32_t AddPoolString(std::string_view str)
+    {
+        const auto offset = static_cast<uint32_t>(_pool.size());
+        _pool.insert(_pool.end(), str.begin(), str.end());
+        _pool.push_back('\0');
+        return offset;
+    }
+
+    bool IsValidOffset(uint32_t offset) const
+    {
+        return offset == kNoString || offset < _pool.size();
+    }
+
+    // Checks that every offset of a compiled language pack points at a null terminated string
+    bool IsValid() const
+    {
+        if (!_pool.empty() && _pool.back() != '\0')
+        {
+            return false;
+        }
+        for (auto offset : _offsets)
+        {
+            if (!IsValidOffset(offset))
+            {
+                return false;
+            }
+        }
+        for (const auto& so : _scenarioOverrides)
+        {
+            if (so.filename == kNoString || !IsValidOffset(so.filename))
+            {
+                return false;
+            }
+            for (auto offset : so.strings)
+            {
+                if (!IsValidOffset(offset))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Points the strings by id into the pool, which must not change anymore after this
+    void ResolveStrings()
+    {
+        _strings.resize(_offsets.size());
+        for (size_t i = 0; i < _offsets.size(); i++)
+        {
+            _strings[i] = GetPoolString(_offsets[i]);
+        }
+    }
+
     ScenarioOverride* GetScenarioOverride(const std::string& scenarioIdentifier)
     {
         for (auto& so : _scenarioOverrides)
         {
-            if (String::IEquals(so.strings[0], scenarioIdentifier))
+            const auto* identifier = GetPoolString(so.strings[0]);
+            if (String::IEquals(identifier != nullptr ? identifier : "", scenarioIdentifier))
             {
                 return &so;
             }
@@ -353,7 +524,7 @@ private:
 
                 _scenarioOverrides.emplace_back();
                 _currentScenarioOverride = &_scenarioOverrides[_scenarioOverrides.size() - 1];
-                _currentScenarioOverride->filename = std::string(sb.GetBuffer());
+                _currentScenarioOverride->filename = AddPoolString(sb.GetBuffer());
             }
         }
     }
@@ -447,31 +618,30 @@ private:
             sb.Append(codepoint);
         }
 
-        std::string s;
+        auto str = std::string_view(sb.GetBuffer(), sb.GetLength());
+        std::string fixedStr;
         if (LanguagesDescriptors[_id].isRtl)
         {
-            auto ts = std::string(sb.GetBuffer(), sb.GetLength());
-            s = FixRTL(ts);
-        }
-        else
-        {
-            s = std::string(sb.GetBuffer(), sb.GetLength());
+            auto ts = std::string(str);
+            fixedStr = FixRTL(ts);
+            str = fixedStr;
         }
+        const auto offset = str.empty() ? kNoString : AddPoolString(str);
 
         if (_currentGroup.empty())
         {
             // Make sure the list is big enough to contain this string id
-            if (static_cast<size_t>(stringId) >= _strings.size())
+            if (static_cast<size_t>(stringId) >= _offsets.size())
             {
-                _strings.resize(stringId + 1);
+                _offsets.resize(stringId + 1, kNoString);
             }
-            _strings[stringId] = s;
+            _offsets[stringId] = offset;
         }
         else
         {
             if (_currentScenarioOverride != nullptr)
             {
-                _currentScenarioOverride->strings[stringId] = std::move(s);
+                _currentScenarioOverride->strings[stringId] = offset;
             }
         }
     }
@@ -485,10 +655,79 @@ namespace OpenRCT2::LanguagePackFactory
         return languagePack;
     }
 
+    static u8string GetCompiledPath(uint16_t id)
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        auto fileName = u8string(LanguagesDescriptors[id].locale) + u8".bin";
+        return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"languages", fileName);
+    }
+
+    static std::unique_ptr<LanguagePack> ReadCompiled(
+        uint16_t id, const u8string& compiledPath, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        if (!File::Exists(compiledPath))
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            uint64_t compiledSourceSize{};
+            uint64_t compiledSourceLastModified{};
+            auto languagePack = LanguagePack::FromCompiled(
+                id, File::ReadAllBytes(compiledPath), compiledSourceSize, compiledSourceLastModified);
+            if (languagePack != nullptr && compiledSourceSize == sourceSize
+                && compiledSourceLastModified == sourceLastModified)
+            {
+                return languagePack;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to read compiled language pack %s: %s", compiledPath.c_str(), e.what());
+        }
+        return nullptr;
+    }
+
+    static void WriteCompiled(
+        const LanguagePack& languagePack, const u8string& compiledPath, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        try
+        {
+            const auto data = languagePack.Compile(sourceSize, sourceLastModified);
+            Path::CreateDirectory(Path::GetDirectory(compiledPath));
+            File::WriteAllBytes(compiledPath, data.data(), data.size());
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to write compiled language pack %s: %s", compiledPath.c_str(), e.what());
+        }
+    }
+
     std::unique_ptr<ILanguagePack> FromLanguageId(uint16_t id)
     {
         auto path = OpenRCT2::GetContext()->GetLocalisationService().GetLanguagePath(id);
-        return LanguagePack::FromFile(id, path.c_str());
+        if (!File::Exists(path))
+        {
+            return LanguagePack::FromFile(id, path.c_str());
+        }
+
+        // The language file is only parsed the first time it is loaded after it changed, afterwards the compiled
+        // language pack in the cache directory is read instead
+        const auto sourceSize = File::GetSize(path);
+        const auto sourceLastModified = File::GetLastModified(path);
+        const auto compiledPath = GetCompiledPath(id);
+        if (auto languagePack = ReadCompiled(id, compiledPath, sourceSize, sourceLastModified))
+        {
+            return languagePack;
+        }
+
+        auto languagePack = LanguagePack::FromFile(id, path.c_str());
+        if (languagePack != nullptr)
+        {
+            WriteCompiled(*languagePack, compiledPath, sourceSize, sourceLastModified);
+        }
+        return languagePack;
     }
 
     std::unique_ptr<ILanguagePack> FromText(uint16_t id, const utf8* text)
@@ -496,4 +735,16 @@ namespace OpenRCT2::LanguagePackFactory
         auto languagePack = LanguagePack::FromText(id, text);
         return languagePack;
     }
+
+    std::unique_ptr<ILanguagePack> FromCompiled(uint16_t id, const std::vector<uint8_t>& data)
+    {
+        uint64_t sourceSize{};
+        uint64_t sourceLastModified{};
+        return LanguagePack::FromCompiled(id, data, sourceSize, sourceLastModified);
+    }
+
+    std::vector<uint8_t> Compile(uint16_t id, const utf8* text)
+    {
+        return LanguagePack::FromText(id, text)->Compile(0, 0);
+    }
 } // namespace OpenRCT2::LanguagePackFactory
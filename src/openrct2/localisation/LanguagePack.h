@@ -13,6 +13,7 @@
 #include "../localisation/StringIdType.h"
 
 #include <memory>
+#include <vector>
 
 struct ILanguagePack
 {
@@ -30,6 +31,21 @@ struct ILanguagePack
 namespace OpenRCT2::LanguagePackFactory
 {
     std::unique_ptr<ILanguagePack> FromFile(uint16_t id, const utf8* path);
+
+    /**
+     * Loads the language file of the given language, using the compiled copy in the cache directory when the file has
+     * not changed since it was compiled.
+     */
     std::unique_ptr<ILanguagePack> FromLanguageId(uint16_t id);
     std::unique_ptr<ILanguagePack> FromText(uint16_t id, const utf8* text);
+
+    /**
+     * Loads a language pack compiled with Compile, returns nullptr if the data is invalid or for another language.
+     */
+    std::unique_ptr<ILanguagePack> FromCompiled(uint16_t id, const std::vector<uint8_t>& data);
+
+    /**
+     * Parses the language file text into the compiled form, a single block of strings with a table of offsets.
+     */
+    std::vector<uint8_t> Compile(uint16_t id, const utf8* text);
 } // namespace OpenRCT2::LanguagePackFactory
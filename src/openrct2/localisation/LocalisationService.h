@@ -12,6 +12,7 @@
 #include "../localisation/StringIdType.h"
 
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <string>
 #include <string_view>
@@ -38,6 +39,7 @@ namespace OpenRCT2::Localisation
         std::vector<std::unique_ptr<ILanguagePack>> _loadedLanguages;
         std::stack<StringId> _availableObjectStringIds;
         std::vector<std::string> _objectStrings;
+        std::mutex _objectStringsMutex;
 
     public:
         int32_t GetCurrentLanguage() const
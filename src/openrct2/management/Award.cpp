@@ -12,6 +12,7 @@
 #include "../GameState.h"
 #include "../config/Config.h"
 #include "../entity/Guest.h"
+#include "../entity/GuestStatistics.h"
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
 #include "../profiling/Profiling.h"
@@ -73,6 +74,11 @@ bool AwardIsPositive(AwardType type)
 
 #pragma region Award checks
 
+static uint32_t GetUntidyThoughtCount(const GuestStatistics& stats)
+{
+    return stats.GetFreshThoughtCount(PeepThoughtType::BadLitter, PeepThoughtType::PathDisgusting, PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
 {
@@ -83,23 +89,8 @@ static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    const auto& stats = GuestStatistics::Get();
+    const auto negativeCount = GetUntidyThoughtCount(stats);
     return (negativeCount > GetGameState().NumGuestsInPark / 16);
 }
 
@@ -111,27 +102,9 @@ static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    const auto& stats = GuestStatistics::Get();
+    const auto positiveCount = stats.GetFreshThoughtCount(PeepThoughtType::VeryClean);
+    const auto negativeCount = GetUntidyThoughtCount(stats);
     return (negativeCount <= 5 && positiveCount > GetGameState().NumGuestsInPark / 64);
 }
 
@@ -193,28 +166,9 @@ static bool AwardIsDeservedMostBeautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    const auto& stats = GuestStatistics::Get();
+    const auto positiveCount = stats.GetFreshThoughtCount(PeepThoughtType::Scenery);
+    const auto negativeCount = GetUntidyThoughtCount(stats);
     return (negativeCount <= 15 && positiveCount > GetGameState().NumGuestsInPark / 128);
 }
 
@@ -239,17 +193,7 @@ static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool AwardIsDeservedSafest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
+    const auto peepsWhoDislikeVandalism = GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Vandalism);
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
@@ -309,16 +253,7 @@ static bool AwardIsDeservedBestFood(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
@@ -354,16 +289,7 @@ static bool AwardIsDeservedWorstFood(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
@@ -386,16 +312,7 @@ static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes
         return false;
 
     // Count number of guests who are thinking they need the toilet
-    auto guestsWhoNeedToilet = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedToilet++;
-    }
+    const auto guestsWhoNeedToilet = GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Toilet);
     return (guestsWhoNeedToilet <= 16);
 }
 
@@ -517,20 +434,9 @@ static bool AwardIsDeservedMostDazzlingRideColours(int32_t activeAwardTypes)
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
-
-    return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
+    const auto& stats = GuestStatistics::Get();
+    const auto peepsLost = stats.GetFreshThoughtCount(PeepThoughtType::Lost, PeepThoughtType::CantFind);
+    return (peepsLost >= 10 && peepsLost >= stats.GuestsInPark / 64);
 }
 
 /** At least 10 open gentle rides. */
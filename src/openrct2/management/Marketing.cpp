@@ -14,6 +14,7 @@
 #include "../GameState.h"
 #include "../config/Config.h"
 #include "../entity/Guest.h"
+#include "../entity/GuestStatistics.h"
 #include "../interface/Window.h"
 #include "../localisation/Formatter.h"
 #include "../profiling/Profiling.h"
@@ -179,6 +180,7 @@ void MarketingSetGuestCampaign(Guest* peep, int32_t campaignType)
             peep->GuestIsLostCountdown = 240;
             break;
     }
+    GuestStatistics::UpdateGuest(*peep);
 }
 
 bool MarketingIsCampaignTypeApplicable(int32_t campaignType)
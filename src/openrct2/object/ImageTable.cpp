@@ -16,6 +16,7 @@
 #include "../core/File.h"
 #include "../core/FileScanner.h"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -24,6 +25,7 @@
 #include "Object.h"
 #include "ObjectFactory.h"
 
+#include <exception>
 #include <memory>
 #include <stdexcept>
 
@@ -484,6 +486,8 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObjectContext* context, json_t& jsonImages)
 {
     std::vector<std::pair<std::string, Image>> result;
+    std::vector<std::vector<uint8_t>> imageData;
+    std::vector<IMAGE_FORMAT> imageFormats;
     for (auto& jsonImage : jsonImages)
     {
         if (jsonImage.is_object() && jsonImage.contains("path"))
@@ -495,14 +499,52 @@ std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObje
             });
             if (itSource == result.end())
             {
-                auto imageData = context->GetData(path);
-                auto imageFormat = keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
-                auto image = Imaging::ReadFromBuffer(imageData, imageFormat);
-                auto pair = std::make_pair<std::string, Image>(std::move(path), std::move(image));
-                result.push_back(std::move(pair));
+                imageData.push_back(context->GetData(path));
+                imageFormats.push_back(keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32);
+                result.emplace_back(std::move(path), Image{});
             }
         }
     }
+
+    // The sources only depend on their own data, so objects with several image sheets decode them at the same time,
+    // unless the object is already being loaded on a job pool thread along with other objects
+    std::vector<std::exception_ptr> errors(result.size());
+    auto decodeImage = [&](size_t index) {
+        try
+        {
+            result[index].second = Imaging::ReadFromBuffer(imageData[index], imageFormats[index]);
+        }
+        catch (...)
+        {
+            errors[index] = std::current_exception();
+        }
+    };
+
+    if (result.size() > 1 && !JobPool::IsWorkerThread())
+    {
+        JobPool jobs{};
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            jobs.AddTask([i, &decodeImage]() { decodeImage(i); });
+        }
+        jobs.Join();
+    }
+    else
+    {
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            decodeImage(i);
+        }
+    }
+
+    // Report the error of the first bad source, the same one decoding them one by one would have hit
+    for (const auto& error : errors)
+    {
+        if (error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+    }
     return result;
 }
 
@@ -312,7 +312,7 @@ bool ObjectAsset::IsAvailable() const
         return File::Exists(_path);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::TryOpenShared(_zipPath);
     return zipArchive != nullptr && zipArchive->Exists(_path);
 }
 
@@ -323,7 +323,7 @@ uint64_t ObjectAsset::GetSize() const
         return File::GetSize(_path);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::TryOpenShared(_zipPath);
     if (zipArchive != nullptr)
     {
         auto index = zipArchive->GetIndexFromPath(_path);
@@ -343,7 +343,7 @@ std::vector<uint8_t> ObjectAsset::GetData() const
         return File::ReadAllBytes(_path);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::TryOpenShared(_zipPath);
     if (zipArchive != nullptr)
     {
         return zipArchive->GetFileData(_path);
@@ -360,7 +360,7 @@ std::unique_ptr<IStream> ObjectAsset::GetStream() const
             return std::make_unique<FileStream>(_path, FILE_MODE_OPEN);
         }
 
-        auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+        auto zipArchive = Zip::TryOpenShared(_zipPath);
         if (zipArchive != nullptr)
         {
             auto stream = zipArchive->GetFileStream(_path);
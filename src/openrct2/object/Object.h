@@ -353,5 +353,15 @@ constexpr bool IsIntransientObjectType(ObjectType type)
     return type == ObjectType::Audio;
 }
 
+/**
+ * Whether Object::Load for the given type only touches the object itself, the image list and the object string table,
+ * so it can run on a worker thread alongside other loads. Audio and music load samples through the audio context and
+ * water objects replace the global palette, these have to be loaded on the calling thread.
+ */
+constexpr bool CanLoadObjectTypeConcurrently(ObjectType type)
+{
+    return type != ObjectType::Audio && type != ObjectType::Music && type != ObjectType::Water;
+}
+
 u8string VersionString(const ObjectVersion& version);
 ObjectVersion VersionTuple(std::string_view version);
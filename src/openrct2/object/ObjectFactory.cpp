@@ -431,7 +431,8 @@ namespace OpenRCT2::ObjectFactory
     {
         try
         {
-            auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+            // Shared, so that the assets read once the object is loaded do not open the file again
+            auto archive = Zip::OpenShared(path);
             auto jsonBytes = archive->GetFileData("object.json");
             if (jsonBytes.empty())
             {
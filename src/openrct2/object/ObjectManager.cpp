@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <array>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -570,6 +571,71 @@ private:
         OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(currentProgress), 100, STR_STRING_M_PERCENT);
     }
 
+    /**
+     * Calls Load on the given objects. Images are reserved up front in the order of the list so image ids do not depend
+     * on thread timing, after which the objects that allow it are loaded in parallel.
+     */
+    static void LoadNewObjects(const std::vector<Object*>& newObjects)
+    {
+        std::vector<Object*> concurrentObjects;
+        std::vector<Object*> serialObjects;
+        for (auto* obj : newObjects)
+        {
+            if (CanLoadObjectTypeConcurrently(obj->GetObjectType()))
+            {
+                obj->LoadImages();
+                concurrentObjects.push_back(obj);
+            }
+            else
+            {
+                serialObjects.push_back(obj);
+            }
+        }
+
+        // Starting the worker threads costs more than loading a single object
+        if (concurrentObjects.size() > 1)
+        {
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            JobPool jobs{};
+            for (auto* obj : concurrentObjects)
+            {
+                jobs.AddTask([obj, &errorMutex, &error]() {
+                    try
+                    {
+                        obj->Load();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> guard(errorMutex);
+                        if (error == nullptr)
+                        {
+                            error = std::current_exception();
+                        }
+                    }
+                });
+            }
+            jobs.Join();
+
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+        else
+        {
+            for (auto* obj : concurrentObjects)
+            {
+                obj->Load();
+            }
+        }
+
+        for (auto* obj : serialObjects)
+        {
+            obj->Load();
+        }
+    }
+
     void LoadObjects(std::vector<ObjectToLoad>& requiredObjects, bool reportProgress)
     {
         std::vector<Object*> objects;
@@ -601,6 +667,7 @@ private:
         auto numProcessed = 0;
         auto numRequired = objectsToLoad.size();
         std::mutex commonMutex;
+        std::unordered_set<Object*> newObjects;
         auto loadSingleObject = [&](const ObjectRepositoryItem* requiredObject) {
             // Object requires to be loaded, if the object successfully loads it will register it
             // as a loaded object otherwise placed into the badObjects list.
@@ -614,7 +681,7 @@ private:
             }
             else
             {
-                newLoadedObjects.push_back(newObject.get());
+                newObjects.insert(newObject.get());
                 // Connect the ori to the registered object
                 _objectRepository.RegisterLoadedObject(requiredObject, std::move(newObject));
             }
@@ -627,15 +694,26 @@ private:
                 ReportProgress(numProcessed, numRequired);
         };
 
-        // Dispatch loading the objects
-        JobPool jobs{};
-        for (auto* object : objectsToLoad)
+        // Dispatch loading the objects, on the calling thread when there is only one
+        if (objectsToLoad.size() > 1)
         {
-            jobs.AddTask([object, &loadSingleObject]() { loadSingleObject(object); }, completionFn);
-        }
+            JobPool jobs{};
+            for (auto* object : objectsToLoad)
+            {
+                jobs.AddTask([object, &loadSingleObject]() { loadSingleObject(object); }, completionFn);
+            }
 
-        // Wait until all jobs are fully completed
-        jobs.Join();
+            // Wait until all jobs are fully completed
+            jobs.Join();
+        }
+        else
+        {
+            for (auto* object : objectsToLoad)
+            {
+                loadSingleObject(object);
+                completionFn();
+            }
+        }
 
         // Assign the loaded objects to the required objects
         for (auto& requiredObject : requiredObjects)
@@ -652,14 +730,16 @@ private:
             }
             requiredObject.LoadedObject = loadedObject;
             objects.push_back(loadedObject);
-        }
 
-        // Load objects
-        for (auto* obj : newLoadedObjects)
-        {
-            obj->Load();
+            // Keep the new objects in the order they are required rather than the order the jobs finished in
+            if (newObjects.erase(loadedObject) != 0)
+            {
+                newLoadedObjects.push_back(loadedObject);
+            }
         }
 
+        LoadNewObjects(newLoadedObjects);
+
         if (!badObjects.empty())
         {
             // Unload all the new objects we loaded
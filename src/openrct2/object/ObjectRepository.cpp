@@ -24,6 +24,7 @@
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Zip.h"
 #include "../localisation/LocalisationService.h"
 #include "../object/Object.h"
 #include "../park/Legacy.h"
@@ -199,6 +200,9 @@ public:
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
         SortItems();
+
+        // Do not keep the files that were opened for indexing open
+        Zip::CloseShared();
     }
 
     void Construct(int32_t language) override
@@ -206,6 +210,7 @@ public:
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
+        Zip::CloseShared();
     }
 
     size_t GetNumObjects() const override
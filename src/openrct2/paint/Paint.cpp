@@ -21,6 +21,7 @@
 #include "../profiling/Profiling.h"
 #include "../util/Math.hpp"
 #include "../util/Prefetch.h"
+#include "../world/Map.h"
 #include "Boundbox.h"
 #include "Paint.Entity.h"
 #include "tile_element/Paint.TileElement.h"
@@ -219,9 +220,14 @@ template<uint8_t direction> void PaintSessionGenerateRotate(PaintSession& sessio
         CoordsXY{ 32, 0 }.Rotate(direction),
     };
     constexpr CoordsXY nextVerticalTile = CoordsXY{ 32, 32 }.Rotate(direction);
+    // Start fetching the elements of the tiles painted a couple of iterations from now
+    constexpr CoordsXY prefetchTile = CoordsXY{ 64, 64 }.Rotate(direction);
 
     for (; numVerticalTiles > 0; --numVerticalTiles)
     {
+        MapPrefetchTileElements(TileCoordsXY(mapTile + prefetchTile));
+        MapPrefetchTileElements(TileCoordsXY(mapTile + prefetchTile + adjacentTiles[1]));
+
         TileElementPaintSetup(session, mapTile);
         EntityPaintSetup(session, mapTile);
 
@@ -78,7 +78,7 @@ void Painter::Paint(IDrawingEngine& de)
 
     if (Config::Get().general.ShowFPS)
     {
-        PaintFPS(*dpi);
+        PaintFPS(de, *dpi);
     }
     gCurrentDrawCount++;
 }
@@ -108,7 +108,7 @@ static bool ShouldShowFPS()
     return WindowFindByClass(WindowClass::TopToolbar);
 }
 
-void Painter::PaintFPS(DrawPixelInfo& dpi)
+void Painter::PaintFPS(IDrawingEngine& de, DrawPixelInfo& dpi)
 {
     if (!ShouldShowFPS())
         return;
@@ -116,7 +116,20 @@ void Painter::PaintFPS(DrawPixelInfo& dpi)
     MeasureFPS();
 
     char buffer[64]{};
-    FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32}", _currentFPS);
+    if (gShowDirtyVisuals && (de.GetFlags() & DEF_DIRTY_OPTIMISATIONS))
+    {
+        // Show how much of the screen the dirty regions made us redraw this frame
+        const auto stats = de.GetDirtyRegionStats();
+        const auto screenPixels = std::max<uint64_t>(1, static_cast<uint64_t>(dpi.width) * dpi.height);
+        const auto percentage = static_cast<int32_t>(stats.RepaintedPixels * 100 / screenPixels);
+        FormatStringToBuffer(
+            buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32} ({INT32}% in {INT32})", _currentFPS, percentage,
+            static_cast<int32_t>(stats.RepaintedRects));
+    }
+    else
+    {
+        FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32}", _currentFPS);
+    }
     const int32_t stringWidth = GfxGetStringWidth(buffer, FontStyle::Medium);
 
     // Figure out where counter should be rendered
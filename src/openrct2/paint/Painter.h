@@ -52,7 +52,7 @@ namespace OpenRCT2
 
         private:
             void PaintReplayNotice(DrawPixelInfo& dpi, const char* text);
-            void PaintFPS(DrawPixelInfo& dpi);
+            void PaintFPS(Drawing::IDrawingEngine& de, DrawPixelInfo& dpi);
             void MeasureFPS();
         };
     } // namespace Paint
@@ -0,0 +1,528 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FootpathGraph.h"
+
+#include "../GameState.h"
+#include "../profiling/Profiling.h"
+#include "../world/Map.h"
+#include "GuestPathfinding.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenRCT2::PathFinding
+{
+    static constexpr uint32_t kNoIndex = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t kNoDistance = std::numeric_limits<uint32_t>::max();
+    // Fields are only needed for the goals guests are heading to, so drop them all rather than grow without bound.
+    static constexpr size_t kMaxCachedFields = 64;
+
+    /**
+     * A junction, dead end or ride queue tile. Every other path tile leads to exactly two others and lies on the
+     * corridor of an edge between two nodes.
+     */
+    struct FootpathGraphNode
+    {
+        TileCoordsXYZ Location;
+        uint32_t FirstEdge;
+        uint8_t NumEdges;
+        RideId QueueRideIndex;
+    };
+
+    struct FootpathGraphEdge
+    {
+        uint32_t From;
+        uint32_t To;
+        // The edge walking the same corridor the other way, if it has any tiles
+        uint32_t Reverse;
+        uint32_t Length;
+        Direction Exit;
+    };
+
+    struct FootpathGraphTile
+    {
+        // The node at this tile, or the edge whose corridor the tile lies on
+        uint32_t Index;
+        // The number of steps along that edge from its first node, 0 for nodes
+        uint32_t Offset;
+        uint8_t Edges;
+        Direction SlopeDirection;
+        Direction Forward;
+        Direction Backward;
+    };
+
+    struct FootpathGraphField
+    {
+        // The number of steps from each node to the goal
+        std::vector<uint32_t> Distances;
+        // The offsets of the corridor tiles on each edge that lead straight onto the goal
+        std::unordered_map<uint32_t, std::vector<uint32_t>> Approaches;
+    };
+
+    static struct
+    {
+        std::vector<FootpathGraphNode> Nodes;
+        std::vector<FootpathGraphEdge> Edges;
+        std::vector<uint32_t> IncomingFirst;
+        std::vector<uint32_t> Incoming;
+        std::unordered_map<uint32_t, FootpathGraphTile> Tiles;
+        std::unordered_map<uint64_t, FootpathGraphField> Fields;
+        uint32_t Revision;
+        bool Built;
+    } _footpathGraph;
+
+    static uint32_t GetTileKey(const TileCoordsXYZ& loc)
+    {
+        return (static_cast<uint32_t>(loc.x & 0xFFF) << 20) | (static_cast<uint32_t>(loc.y & 0xFFF) << 8)
+            | static_cast<uint32_t>(loc.z & 0xFF);
+    }
+
+    /**
+     * A path tile as the graph is built, combining all path elements at that height as the heuristic search does. The
+     * slope of the first of them decides the height of the neighbouring tiles.
+     */
+    struct FootpathGraphPathTile
+    {
+        TileCoordsXYZ Location;
+        uint8_t Edges;
+        uint8_t OutDirections;
+        uint8_t NumIncoming;
+        Direction SlopeDirection = INVALID_DIRECTION;
+        RideId QueueRideIndex = RideId::GetNull();
+        std::array<uint32_t, kNumOrthogonalDirections> Next;
+        uint32_t Node = kNoIndex;
+    };
+
+    static TileCoordsXYZ GetPathStepLocation(const TileCoordsXYZ& loc, Direction slopeDirection, Direction direction)
+    {
+        const auto next = TileCoordsXY{ loc } + TileDirectionDelta[direction];
+        return { next, slopeDirection == direction ? loc.z + 2 : loc.z };
+    }
+
+    static std::optional<TileCoordsXYZ> FindPathAtStep(const TileCoordsXYZ& next, Direction direction)
+    {
+        auto* tileElement = MapGetFirstElementAt(next);
+        if (tileElement == nullptr)
+            return std::nullopt;
+        do
+        {
+            if (tileElement->IsGhost() || tileElement->GetType() != TileElementType::Path)
+                continue;
+            if (!IsValidPathZAndDirection(tileElement, next.z, direction))
+                continue;
+            return TileCoordsXYZ{ next.x, next.y, tileElement->BaseHeight };
+        } while (!(tileElement++)->IsLastForTile());
+        return std::nullopt;
+    }
+
+    static std::vector<FootpathGraphPathTile> GatherPathTiles(std::unordered_map<uint32_t, uint32_t>& indices)
+    {
+        std::vector<FootpathGraphPathTile> pathTiles;
+        const auto& mapSize = GetGameState().MapSize;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                auto* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (tileElement == nullptr)
+                    continue;
+                do
+                {
+                    if (tileElement->IsGhost() || tileElement->GetType() != TileElementType::Path)
+                        continue;
+
+                    auto* pathElement = tileElement->AsPath();
+                    const TileCoordsXYZ loc = { x, y, tileElement->BaseHeight };
+                    auto [it, inserted] = indices.try_emplace(GetTileKey(loc), static_cast<uint32_t>(pathTiles.size()));
+                    if (inserted)
+                    {
+                        auto& pathTile = pathTiles.emplace_back();
+                        pathTile.Location = loc;
+                        pathTile.Edges = 0;
+                        if (pathElement->IsSloped())
+                            pathTile.SlopeDirection = pathElement->GetSlopeDirection();
+                    }
+
+                    auto& pathTile = pathTiles[it->second];
+                    pathTile.Edges |= PathGetPermittedEdges(false, pathElement);
+                    if (pathElement->IsQueue() && std::popcount(pathElement->GetEdges()) == 2
+                        && !pathElement->GetRideIndex().IsNull())
+                    {
+                        pathTile.QueueRideIndex = pathElement->GetRideIndex();
+                    }
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        return pathTiles;
+    }
+
+    static void LinkPathTiles(
+        std::vector<FootpathGraphPathTile>& pathTiles, const std::unordered_map<uint32_t, uint32_t>& indices)
+    {
+        for (auto& pathTile : pathTiles)
+        {
+            pathTile.OutDirections = 0;
+            pathTile.NumIncoming = 0;
+            for (Direction direction : ALL_DIRECTIONS)
+            {
+                pathTile.Next[direction] = kNoIndex;
+                if (!(pathTile.Edges & (1 << direction)))
+                    continue;
+
+                auto next = FindPathAtStep(
+                    GetPathStepLocation(pathTile.Location, pathTile.SlopeDirection, direction), direction);
+                if (!next.has_value())
+                    continue;
+
+                auto it = indices.find(GetTileKey(*next));
+                if (it == indices.end())
+                    continue;
+
+                pathTile.Next[direction] = it->second;
+                pathTile.OutDirections |= 1 << direction;
+            }
+        }
+
+        for (auto& pathTile : pathTiles)
+        {
+            for (Direction direction : ALL_DIRECTIONS)
+            {
+                if (pathTile.Next[direction] != kNoIndex)
+                    pathTiles[pathTile.Next[direction]].NumIncoming++;
+            }
+        }
+    }
+
+    /**
+     * Path tiles that can be walked through both ways between exactly two neighbours are corridor tiles, everything
+     * else is a node. Queues for rides are nodes too as guests may not be allowed through them.
+     */
+    static bool IsCorridorTile(const std::vector<FootpathGraphPathTile>& pathTiles, uint32_t index)
+    {
+        const auto& pathTile = pathTiles[index];
+        if (std::popcount(pathTile.OutDirections) != 2 || pathTile.NumIncoming != 2 || !pathTile.QueueRideIndex.IsNull())
+            return false;
+
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            const auto next = pathTile.Next[direction];
+            if (next != kNoIndex && pathTiles[next].Next[DirectionReverse(direction)] != index)
+                return false;
+        }
+        return true;
+    }
+
+    static void AddNode(FootpathGraphPathTile& pathTile)
+    {
+        auto& graph = _footpathGraph;
+        pathTile.Node = static_cast<uint32_t>(graph.Nodes.size());
+        graph.Nodes.push_back({ pathTile.Location, 0, 0, pathTile.QueueRideIndex });
+        graph.Tiles.emplace(
+            GetTileKey(pathTile.Location),
+            FootpathGraphTile{ pathTile.Node, 0, pathTile.Edges, pathTile.SlopeDirection, INVALID_DIRECTION,
+                               INVALID_DIRECTION });
+    }
+
+    /**
+     * Walks each direction out of a node along its corridor to the next node, recording the corridor tiles on the
+     * first edge to walk them.
+     */
+    static void AddNodeEdges(std::vector<FootpathGraphPathTile>& pathTiles, const FootpathGraphPathTile& nodeTile)
+    {
+        auto& graph = _footpathGraph;
+        auto& node = graph.Nodes[nodeTile.Node];
+        node.FirstEdge = static_cast<uint32_t>(graph.Edges.size());
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (!(nodeTile.OutDirections & (1 << direction)))
+                continue;
+
+            const auto edgeIndex = static_cast<uint32_t>(graph.Edges.size());
+            FootpathGraphEdge edge = { nodeTile.Node, kNoIndex, kNoIndex, 1, direction };
+            auto current = nodeTile.Next[direction];
+            auto heading = direction;
+            while (pathTiles[current].Node == kNoIndex)
+            {
+                const auto& pathTile = pathTiles[current];
+                const auto backward = DirectionReverse(heading);
+                const auto forward = static_cast<Direction>(
+                    std::countr_zero(static_cast<uint32_t>(pathTile.OutDirections & ~(1 << backward))));
+
+                auto [it, inserted] = graph.Tiles.try_emplace(
+                    GetTileKey(pathTile.Location),
+                    FootpathGraphTile{ edgeIndex, edge.Length, pathTile.Edges, pathTile.SlopeDirection, forward, backward });
+                if (!inserted && edge.Length == 1)
+                {
+                    // The corridor was already walked from its other end
+                    edge.Reverse = it->second.Index;
+                    graph.Edges[edge.Reverse].Reverse = edgeIndex;
+                }
+
+                current = pathTile.Next[forward];
+                heading = forward;
+                edge.Length++;
+            }
+            edge.To = pathTiles[current].Node;
+            graph.Edges.push_back(edge);
+            node.NumEdges++;
+        }
+    }
+
+    static void BuildFootpathGraph()
+    {
+        PROFILED_FUNCTION();
+
+        auto& graph = _footpathGraph;
+        graph.Nodes.clear();
+        graph.Edges.clear();
+        graph.Tiles.clear();
+        graph.Fields.clear();
+
+        std::unordered_map<uint32_t, uint32_t> indices;
+        auto pathTiles = GatherPathTiles(indices);
+        LinkPathTiles(pathTiles, indices);
+
+        for (uint32_t i = 0; i < pathTiles.size(); i++)
+        {
+            if (!IsCorridorTile(pathTiles, i))
+                AddNode(pathTiles[i]);
+        }
+        for (const auto& pathTile : pathTiles)
+        {
+            if (pathTile.Node != kNoIndex)
+                AddNodeEdges(pathTiles, pathTile);
+        }
+
+        // Corridors still not walked are loops without a junction, so make one of their tiles a node.
+        for (auto& pathTile : pathTiles)
+        {
+            if (pathTile.Node == kNoIndex && graph.Tiles.count(GetTileKey(pathTile.Location)) == 0)
+            {
+                AddNode(pathTile);
+                AddNodeEdges(pathTiles, pathTile);
+            }
+        }
+
+        graph.IncomingFirst.assign(graph.Nodes.size() + 1, 0);
+        for (const auto& edge : graph.Edges)
+            graph.IncomingFirst[edge.To + 1]++;
+        for (size_t i = 1; i < graph.IncomingFirst.size(); i++)
+            graph.IncomingFirst[i] += graph.IncomingFirst[i - 1];
+
+        graph.Incoming.resize(graph.Edges.size());
+        auto nextIncoming = graph.IncomingFirst;
+        for (uint32_t i = 0; i < graph.Edges.size(); i++)
+            graph.Incoming[nextIncoming[graph.Edges[i].To]++] = i;
+    }
+
+    static void UpdateFootpathGraph()
+    {
+        auto& graph = _footpathGraph;
+        const auto revision = MapGetTileElementsRevision();
+        if (!graph.Built || graph.Revision != revision)
+        {
+            BuildFootpathGraph();
+            graph.Revision = revision;
+            graph.Built = true;
+        }
+    }
+
+    static const FootpathGraphTile* GetGraphTile(const TileCoordsXYZ& loc)
+    {
+        const auto& tiles = _footpathGraph.Tiles;
+        auto it = tiles.find(GetTileKey(loc));
+        return it != tiles.end() ? &it->second : nullptr;
+    }
+
+    static bool IsStepOntoGoal(
+        const TileCoordsXYZ& loc, const FootpathGraphTile& tile, Direction direction, const TileCoordsXYZ& goal)
+    {
+        return (tile.Edges & (1 << direction)) && GetPathStepLocation(loc, tile.SlopeDirection, direction) == goal;
+    }
+
+    static void BuildFootpathGraphField(
+        FootpathGraphField& field, const TileCoordsXYZ& goal, RideId queueRideIndex, bool ignoreForeignQueues)
+    {
+        PROFILED_FUNCTION();
+
+        const auto& graph = _footpathGraph;
+        auto isBlocked = [&](uint32_t nodeIndex) {
+            const auto& queueRide = graph.Nodes[nodeIndex].QueueRideIndex;
+            return ignoreForeignQueues && !queueRide.IsNull() && queueRide != queueRideIndex;
+        };
+
+        using QueueEntry = std::pair<uint32_t, uint32_t>;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        field.Distances.assign(graph.Nodes.size(), kNoDistance);
+        auto reach = [&](uint32_t nodeIndex, uint32_t distance) {
+            if (!isBlocked(nodeIndex) && distance < field.Distances[nodeIndex])
+            {
+                field.Distances[nodeIndex] = distance;
+                queue.emplace(distance, nodeIndex);
+            }
+        };
+
+        // Start from the path tiles that lead onto the goal, which can be on either side of it and a level below
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            const auto approachTile = TileCoordsXY{ goal } + TileDirectionDelta[DirectionReverse(direction)];
+            for (int32_t z = goal.z - 2; z <= goal.z; z += 2)
+            {
+                const TileCoordsXYZ approach = { approachTile, z };
+                const auto* tile = GetGraphTile(approach);
+                if (tile == nullptr || !IsStepOntoGoal(approach, *tile, direction, goal))
+                    continue;
+
+                if (tile->Offset == 0)
+                {
+                    reach(tile->Index, 1);
+                    continue;
+                }
+
+                const auto& edge = graph.Edges[tile->Index];
+                field.Approaches[tile->Index].push_back(tile->Offset);
+                reach(edge.From, tile->Offset + 1);
+                if (edge.Reverse != kNoIndex)
+                    reach(edge.To, edge.Length - tile->Offset + 1);
+            }
+        }
+
+        while (!queue.empty())
+        {
+            const auto [distance, nodeIndex] = queue.top();
+            queue.pop();
+            if (distance > field.Distances[nodeIndex])
+                continue;
+
+            for (auto i = graph.IncomingFirst[nodeIndex]; i < graph.IncomingFirst[nodeIndex + 1]; i++)
+            {
+                const auto& edge = graph.Edges[graph.Incoming[i]];
+                reach(edge.From, distance + edge.Length);
+            }
+        }
+    }
+
+    static const FootpathGraphField& GetFootpathGraphField(
+        const TileCoordsXYZ& goal, RideId queueRideIndex, bool ignoreForeignQueues)
+    {
+        auto& fields = _footpathGraph.Fields;
+        if (fields.size() >= kMaxCachedFields)
+            fields.clear();
+
+        const auto key = GetTileKey(goal) | (static_cast<uint64_t>(queueRideIndex.ToUnderlying()) << 32)
+            | (static_cast<uint64_t>(ignoreForeignQueues) << 48);
+        auto [it, inserted] = fields.try_emplace(key);
+        if (inserted)
+            BuildFootpathGraphField(it->second, goal, queueRideIndex, ignoreForeignQueues);
+        return it->second;
+    }
+
+    static uint32_t AddDistance(uint32_t steps, uint32_t distance)
+    {
+        return distance == kNoDistance ? kNoDistance : steps + distance;
+    }
+
+    /**
+     * Gets the number of steps to the goal walking along an edge from the given offset, either to the end of the edge
+     * or to a corridor tile on it that leads onto the goal.
+     */
+    static uint32_t GetEdgeDistance(const FootpathGraphField& field, uint32_t edgeIndex, uint32_t offset)
+    {
+        const auto& edge = _footpathGraph.Edges[edgeIndex];
+        auto best = AddDistance(edge.Length - offset, field.Distances[edge.To]);
+
+        auto it = field.Approaches.find(edgeIndex);
+        if (it != field.Approaches.end())
+        {
+            for (auto approach : it->second)
+            {
+                if (approach > offset)
+                    best = std::min(best, approach - offset + 1);
+            }
+        }
+
+        // Approaches are recorded on the edge that first walked the corridor, so also look along it backwards
+        if (edge.Reverse != kNoIndex)
+        {
+            it = field.Approaches.find(edge.Reverse);
+            if (it != field.Approaches.end())
+            {
+                const auto reverseOffset = edge.Length - offset;
+                for (auto approach : it->second)
+                {
+                    if (approach < reverseOffset)
+                        best = std::min(best, reverseOffset - approach + 1);
+                }
+            }
+        }
+        return best;
+    }
+
+    Direction ChooseFootpathGraphDirection(
+        const TileCoordsXYZ& loc, const TileCoordsXYZ& goal, uint8_t allowedDirections, RideId queueRideIndex,
+        bool ignoreForeignQueues)
+    {
+        PROFILED_FUNCTION();
+
+        UpdateFootpathGraph();
+        const auto* tile = GetGraphTile(loc);
+        if (tile == nullptr)
+            return INVALID_DIRECTION;
+
+        const auto& graph = _footpathGraph;
+        const auto& field = GetFootpathGraphField(goal, queueRideIndex, ignoreForeignQueues);
+
+        // Take the direction with the fewest steps to the goal, the lowest numbered one when several are equally close
+        std::array<uint32_t, kNumOrthogonalDirections> distances;
+        distances.fill(kNoDistance);
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (IsStepOntoGoal(loc, *tile, direction, goal))
+                distances[direction] = 1;
+        }
+
+        if (tile->Offset == 0)
+        {
+            const auto& node = graph.Nodes[tile->Index];
+            for (uint32_t i = node.FirstEdge; i < node.FirstEdge + node.NumEdges; i++)
+            {
+                const auto exit = graph.Edges[i].Exit;
+                distances[exit] = std::min(distances[exit], GetEdgeDistance(field, i, 0));
+            }
+        }
+        else
+        {
+            const auto& edge = graph.Edges[tile->Index];
+            distances[tile->Forward] = std::min(distances[tile->Forward], GetEdgeDistance(field, tile->Index, tile->Offset));
+            const auto backward = edge.Reverse != kNoIndex
+                ? GetEdgeDistance(field, edge.Reverse, edge.Length - tile->Offset)
+                : AddDistance(tile->Offset, field.Distances[edge.From]);
+            distances[tile->Backward] = std::min(distances[tile->Backward], backward);
+        }
+
+        auto bestDistance = kNoDistance;
+        Direction bestDirection = INVALID_DIRECTION;
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if ((allowedDirections & (1 << direction)) && distances[direction] < bestDistance)
+            {
+                bestDistance = distances[direction];
+                bestDirection = direction;
+            }
+        }
+        return bestDirection;
+    }
+} // namespace OpenRCT2::PathFinding
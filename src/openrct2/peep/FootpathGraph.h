@@ -0,0 +1,27 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../world/Location.hpp"
+
+#include <cstdint>
+
+namespace OpenRCT2::PathFinding
+{
+    /**
+     * Gets the direction out of the given path tile, limited to the given directions, on the shortest footpath route a
+     * guest can take to the goal. Queues of rides other than queueRideIndex are not walked through if
+     * ignoreForeignQueues is set. Returns INVALID_DIRECTION if the goal cannot be reached in any of the directions.
+     */
+    Direction ChooseFootpathGraphDirection(
+        const TileCoordsXYZ& loc, const TileCoordsXYZ& goal, uint8_t allowedDirections, RideId queueRideIndex,
+        bool ignoreForeignQueues);
+} // namespace OpenRCT2::PathFinding
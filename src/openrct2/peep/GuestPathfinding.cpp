@@ -22,6 +22,7 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "FootpathGraph.h"
 
 #include <bit>
 #include <bitset>
@@ -170,10 +171,7 @@ namespace OpenRCT2::PathFinding
         return edges;
     }
 
-    /**
-     * Gets the connected edges of a path that are permitted (i.e. no 'no entry' signs)
-     */
-    static int32_t PathGetPermittedEdges(bool ignoreBanners, PathElement* pathElement)
+    int32_t PathGetPermittedEdges(bool ignoreBanners, PathElement* pathElement)
     {
         return BannerClearPathEdges(ignoreBanners, pathElement, pathElement->GetEdgesAndCorners()) & 0x0F;
     }
@@ -570,6 +568,16 @@ namespace OpenRCT2::PathFinding
         return 5;
     }
 
+    /**
+     * Guests carrying a park map, and those heading for the exit, know the
+     * park well enough to find goals beyond the reach of the heuristic search.
+     */
+    static bool GuestKnowsFootpathLayout(const Peep& peep)
+    {
+        const auto* guest = peep.As<Guest>();
+        return guest != nullptr && (guest->HasItem(ShopItem::Map) || (guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK));
+    }
+
     /**
      * Returns if the path as xzy is a 'thin' junction.
      * A junction is considered 'thin' if it has more than 2 edges
@@ -1359,6 +1367,23 @@ namespace OpenRCT2::PathFinding
         // Peep has multiple edges still to try.
         if (edges & ~(1 << chosenEdge))
         {
+            /* The heuristic search gives up at its junction and tile limits,
+             * so guests that know their way around the park follow the
+             * shortest route through the footpath graph, and only search
+             * when the graph has no route to the goal. The route is the
+             * same every time, so the junction is not remembered in the
+             * history the search uses to avoid going round in circles. */
+            if (GuestKnowsFootpathLayout(peep))
+            {
+                const auto graphEdge = ChooseFootpathGraphDirection(
+                    loc, goal, edges, gPeepPathFindQueueRideIndex, gPeepPathFindIgnoreForeignQueues);
+                if (graphEdge != INVALID_DIRECTION)
+                {
+                    LogPathfinding(&peep, "Pathfind footpath graph edge %d", graphEdge);
+                    return graphEdge;
+                }
+            }
+
             uint8_t bestJunctions = 0;
             TileCoordsXYZ bestJunctionList[16];
             uint8_t bestDirectionList[16];
@@ -16,6 +16,7 @@
 
 struct Peep;
 struct Guest;
+struct PathElement;
 struct TileElement;
 
 // When the heuristic pathfinder is examining neighboring tiles, one possibility is that it finds a
@@ -45,4 +46,9 @@ namespace OpenRCT2::PathFinding
 
     bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
 
+    /**
+     * Gets the connected edges of a path that are permitted (i.e. no 'no entry' signs)
+     */
+    int32_t PathGetPermittedEdges(bool ignoreBanners, PathElement* pathElement);
+
 }; // namespace OpenRCT2::PathFinding
@@ -0,0 +1,249 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PathDistanceField.h"
+
+#include "../entity/Staff.h"
+#include "../profiling/Profiling.h"
+#include "../ride/Ride.h"
+#include "../ride/Station.h"
+#include "../world/Map.h"
+#include "../world/TileElementsView.h"
+#include "GuestPathfinding.h"
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenRCT2::PathFinding
+{
+    // The same limit as the heuristic search uses for staff.
+    static constexpr size_t kMaxTilesSearched = 50000;
+    // Fields are only needed for the rides mechanics are heading to, so the least recently used are dropped beyond this.
+    static constexpr size_t kMaxCachedFields = 64;
+
+    struct PathDistanceField
+    {
+        TileCoordsXYZ Goal;
+        std::unordered_map<uint32_t, uint16_t> Distances;
+        uint64_t LastUse{};
+    };
+
+    static std::unordered_map<uint32_t, PathDistanceField> _pathDistanceFields;
+    static uint32_t _pathDistanceFieldsRevision;
+    static uint64_t _pathDistanceFieldsUseCount;
+
+    static uint32_t GetTileKey(const TileCoordsXYZ& loc)
+    {
+        return (static_cast<uint32_t>(loc.x & 0xFFF) << 20) | (static_cast<uint32_t>(loc.y & 0xFFF) << 8)
+            | static_cast<uint32_t>(loc.z & 0xFF);
+    }
+
+    /**
+     * Gets the edges staff can leave a path tile by, combining all path elements at that height as the heuristic
+     * search does. The slope of the first of them decides the height of the neighbouring tiles.
+     */
+    static const PathElement* GetPathAt(const TileCoordsXYZ& loc, uint8_t& edges)
+    {
+        const PathElement* firstPath = nullptr;
+        edges = 0;
+        for (auto* pathElement : TileElementsView<PathElement>(loc.ToCoordsXY()))
+        {
+            if (pathElement->IsGhost() || pathElement->BaseHeight != loc.z)
+                continue;
+            if (firstPath == nullptr)
+                firstPath = pathElement;
+            // Staff are not stopped by no entry banners
+            edges |= PathGetPermittedEdges(true, pathElement);
+        }
+        return firstPath;
+    }
+
+    /**
+     * Gets the tile staff end up on when walking off the path tile at loc in the given direction, which is either the
+     * goal or another path tile.
+     */
+    static std::optional<TileCoordsXYZ> GetPathStep(
+        const TileCoordsXYZ& loc, const PathElement& path, Direction direction, const TileCoordsXYZ& goal)
+    {
+        auto next = loc;
+        if (path.IsSloped() && path.GetSlopeDirection() == direction)
+        {
+            next.z += 2;
+        }
+        next += TileDirectionDelta[direction];
+        if (next == goal)
+        {
+            return goal;
+        }
+
+        auto* tileElement = MapGetFirstElementAt(next);
+        if (tileElement == nullptr)
+            return std::nullopt;
+        do
+        {
+            if (tileElement->IsGhost() || tileElement->GetType() != TileElementType::Path)
+                continue;
+            if (!IsValidPathZAndDirection(tileElement, next.z, direction))
+                continue;
+            return TileCoordsXYZ{ next.x, next.y, tileElement->BaseHeight };
+        } while (!(tileElement++)->IsLastForTile());
+        return std::nullopt;
+    }
+
+    static void BuildPathDistanceField(PathDistanceField& field)
+    {
+        PROFILED_FUNCTION();
+
+        field.Distances.clear();
+        field.Distances.emplace(GetTileKey(field.Goal), 0);
+
+        std::vector<TileCoordsXYZ> frontier = { field.Goal };
+        std::vector<TileCoordsXYZ> nextFrontier;
+        uint16_t distance = 0;
+        while (!frontier.empty() && field.Distances.size() < kMaxTilesSearched)
+        {
+            distance++;
+            for (const auto& loc : frontier)
+            {
+                // Look for the path tiles that lead onto this one, i.e. those a step back in each direction
+                for (Direction direction : ALL_DIRECTIONS)
+                {
+                    const auto previousTile = TileCoordsXY{ loc } + TileDirectionDelta[DirectionReverse(direction)];
+                    if (!MapIsLocationValid(previousTile.ToCoordsXY()))
+                        continue;
+
+                    for (int32_t z = loc.z - 2; z <= loc.z + 2; z += 2)
+                    {
+                        const TileCoordsXYZ previous = { previousTile, z };
+                        const auto key = GetTileKey(previous);
+                        if (field.Distances.count(key) != 0)
+                            continue;
+
+                        uint8_t edges;
+                        auto* path = GetPathAt(previous, edges);
+                        if (path == nullptr || !(edges & (1 << direction)))
+                            continue;
+                        if (GetPathStep(previous, *path, direction, field.Goal) != loc)
+                            continue;
+
+                        field.Distances.emplace(key, distance);
+                        nextFrontier.push_back(previous);
+                    }
+                }
+            }
+            std::swap(frontier, nextFrontier);
+            nextFrontier.clear();
+        }
+    }
+
+    static void EvictLeastRecentlyUsedField()
+    {
+        auto leastRecent = _pathDistanceFields.begin();
+        for (auto it = _pathDistanceFields.begin(); it != _pathDistanceFields.end(); it++)
+        {
+            if (it->second.LastUse < leastRecent->second.LastUse)
+                leastRecent = it;
+        }
+        if (leastRecent != _pathDistanceFields.end())
+            _pathDistanceFields.erase(leastRecent);
+    }
+
+    static const PathDistanceField* GetPathDistanceField(const Ride& ride, StationIndex stationIndex)
+    {
+        const auto revision = MapGetTileElementsRevision();
+        if (_pathDistanceFieldsRevision != revision)
+        {
+            _pathDistanceFields.clear();
+            _pathDistanceFieldsRevision = revision;
+        }
+
+        const auto& station = ride.GetStation(stationIndex);
+        auto goal = station.Exit;
+        if (goal.IsNull())
+        {
+            goal = station.Entrance;
+            if (goal.IsNull())
+                return nullptr;
+        }
+
+        const auto key = (static_cast<uint32_t>(ride.id.ToUnderlying()) << 8) | stationIndex.ToUnderlying();
+        auto it = _pathDistanceFields.find(key);
+        if (it == _pathDistanceFields.end())
+        {
+            if (_pathDistanceFields.size() >= kMaxCachedFields)
+                EvictLeastRecentlyUsedField();
+            it = _pathDistanceFields.emplace(key, PathDistanceField{}).first;
+            it->second.Goal = TileCoordsXYZ{ goal };
+            BuildPathDistanceField(it->second);
+        }
+        else if (it->second.Goal != TileCoordsXYZ{ goal })
+        {
+            it->second.Goal = TileCoordsXYZ{ goal };
+            BuildPathDistanceField(it->second);
+        }
+        it->second.LastUse = ++_pathDistanceFieldsUseCount;
+        return &it->second;
+    }
+
+    static uint16_t GetFieldDistance(const PathDistanceField& field, const TileCoordsXYZ& loc)
+    {
+        auto it = field.Distances.find(GetTileKey(loc));
+        return it != field.Distances.end() ? it->second : kPathDistanceUnreachable;
+    }
+
+    uint16_t GetStationExitPathDistance(const Ride& ride, StationIndex stationIndex, const TileCoordsXYZ& loc)
+    {
+        const auto* field = GetPathDistanceField(ride, stationIndex);
+        if (field == nullptr)
+            return kPathDistanceUnreachable;
+        return GetFieldDistance(*field, loc);
+    }
+
+    Direction ChooseStationExitDirection(
+        const Ride& ride, StationIndex stationIndex, const Staff& mechanic, const TileCoordsXYZ& loc,
+        uint8_t allowedDirections)
+    {
+        const auto* field = GetPathDistanceField(ride, stationIndex);
+        if (field == nullptr)
+            return INVALID_DIRECTION;
+
+        uint8_t edges;
+        const auto* path = GetPathAt(loc, edges);
+        if (path == nullptr)
+            return INVALID_DIRECTION;
+
+        // The field is shared by all mechanics, so the heuristic search's rule that mechanics inside their patrol area
+        // stay inside it is applied to each step instead
+        const bool keepInPatrol = mechanic.HasPatrolArea() && mechanic.IsLocationInPatrol(loc.ToCoordsXY());
+
+        // Walk downhill, taking the lowest numbered direction when several are equally close
+        auto bestDistance = GetFieldDistance(*field, loc);
+        Direction bestDirection = INVALID_DIRECTION;
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (!(edges & allowedDirections & (1 << direction)))
+                continue;
+
+            auto next = GetPathStep(loc, *path, direction, field->Goal);
+            if (!next.has_value())
+                continue;
+            if (keepInPatrol && *next != field->Goal && !mechanic.IsLocationInPatrol(next->ToCoordsXY()))
+                continue;
+
+            auto distance = GetFieldDistance(*field, *next);
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                bestDirection = direction;
+            }
+        }
+        return bestDirection;
+    }
+} // namespace OpenRCT2::PathFinding
@@ -0,0 +1,41 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../world/Location.hpp"
+
+#include <cstdint>
+
+struct Ride;
+struct Staff;
+
+namespace OpenRCT2::PathFinding
+{
+    constexpr uint16_t kPathDistanceUnreachable = 0xFFFF;
+
+    /**
+     * Gets the number of path tiles staff at the given path tile have to walk to reach the exit of a ride station, or its
+     * entrance if it has no exit. Returns kPathDistanceUnreachable if the tile is not connected to it by footpaths. The
+     * distances are found by one breadth first search out from the exit, shared by all staff and kept until the tile
+     * elements change. Like the heuristic search for staff, it walks past no entry banners. Patrol areas are not taken
+     * into account.
+     */
+    uint16_t GetStationExitPathDistance(const Ride& ride, StationIndex stationIndex, const TileCoordsXYZ& loc);
+
+    /**
+     * Gets the direction out of the given path tile, limited to the given directions, that leads closest to the exit of
+     * a ride station. A mechanic inside their patrol area is not sent out of it. Returns INVALID_DIRECTION if no
+     * direction brings the mechanic any closer.
+     */
+    Direction ChooseStationExitDirection(
+        const Ride& ride, StationIndex stationIndex, const Staff& mechanic, const TileCoordsXYZ& loc,
+        uint8_t allowedDirections);
+} // namespace OpenRCT2::PathFinding
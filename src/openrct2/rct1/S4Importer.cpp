@@ -298,22 +298,22 @@ namespace OpenRCT2::RCT1
             auto s4 = std::make_unique<S4>();
             size_t dataSize = stream->GetLength() - stream->GetPosition();
             auto data = stream->ReadArray<uint8_t>(dataSize);
-            auto decodedData = std::make_unique<uint8_t[]>(sizeof(S4));
 
+            // Decode straight into the park structure, the decoder refuses to write past its end
+            auto* decodedData = reinterpret_cast<uint8_t*>(s4.get());
             size_t decodedSize;
             int32_t fileType = SawyerCodingDetectFileType(data.get(), dataSize);
             if (isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1)
             {
-                decodedSize = SawyerCodingDecodeSC4(data.get(), decodedData.get(), dataSize, sizeof(S4));
+                decodedSize = SawyerCodingDecodeSC4(data.get(), decodedData, dataSize, sizeof(S4));
             }
             else
             {
-                decodedSize = SawyerCodingDecodeSV4(data.get(), decodedData.get(), dataSize, sizeof(S4));
+                decodedSize = SawyerCodingDecodeSV4(data.get(), decodedData, dataSize, sizeof(S4));
             }
 
             if (decodedSize == sizeof(S4))
             {
-                std::memcpy(s4.get(), decodedData.get(), sizeof(S4));
                 return s4;
             }
 
@@ -10,9 +10,13 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
+#include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 
+#include <exception>
+
 using namespace OpenRCT2;
 
 // Allow chunks to be uncompressed to a maximum of 16 MiB
@@ -47,39 +51,111 @@ void SawyerChunkReader::SkipChunk()
     }
 }
 
+std::unique_ptr<uint8_t[]> SawyerChunkReader::ReadCompressedChunk(SawyerCodingChunkHeader& header)
+{
+    header = _stream->ReadValue<SawyerCodingChunkHeader>();
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+        case CHUNK_ENCODING_RLE:
+        case CHUNK_ENCODING_RLECOMPRESSED:
+        case CHUNK_ENCODING_ROTATE:
+        {
+            auto compressedData = std::make_unique<uint8_t[]>(header.length);
+            if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            return compressedData;
+        }
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+}
+
+static std::shared_ptr<SawyerChunk> DecodeCompressedChunk(const void* src, const SawyerCodingChunkHeader& header)
+{
+    auto buffer = DecodeChunk(src, header);
+    if (buffer.GetLength() == 0)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+    }
+
+    return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), std::move(buffer));
+}
+
 std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
 {
     uint64_t originalPosition = _stream->GetPosition();
     try
     {
-        auto header = _stream->ReadValue<SawyerCodingChunkHeader>();
-        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
-            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+        SawyerCodingChunkHeader header;
+        auto compressedData = ReadCompressedChunk(header);
+        return DecodeCompressedChunk(compressedData.get(), header);
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+std::vector<std::shared_ptr<SawyerChunk>> SawyerChunkReader::ReadChunks(size_t count)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        std::vector<SawyerCodingChunkHeader> headers(count);
+        std::vector<std::unique_ptr<uint8_t[]>> compressedData(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            compressedData[i] = ReadCompressedChunk(headers[i]);
+        }
+
+        std::vector<std::shared_ptr<SawyerChunk>> chunks(count);
+        std::vector<std::exception_ptr> errors(count);
+        auto decodeChunk = [&](size_t index) {
+            try
+            {
+                chunks[index] = DecodeCompressedChunk(compressedData[index].get(), headers[index]);
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        };
 
-        switch (header.encoding)
+        // Files read from a pool, such as the scenario index, already keep every core busy
+        if (count > 1 && !JobPool::IsWorkerThread())
         {
-            case CHUNK_ENCODING_NONE:
-            case CHUNK_ENCODING_RLE:
-            case CHUNK_ENCODING_RLECOMPRESSED:
-            case CHUNK_ENCODING_ROTATE:
+            JobPool jobs{};
+            for (size_t i = 0; i < count; i++)
             {
-                auto compressedData = std::make_unique<uint8_t[]>(header.length);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-                }
-
-                auto buffer = DecodeChunk(compressedData.get(), header);
-                if (buffer.GetLength() == 0)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
-                }
-
-                return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), std::move(buffer));
+                jobs.AddTask([i, &decodeChunk]() { decodeChunk(i); });
             }
-            default:
-                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+            jobs.Join();
         }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                decodeChunk(i);
+            }
+        }
+
+        // Report the error of the earliest bad chunk, the same one reading the chunks one by one would have hit
+        for (const auto& error : errors)
+        {
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+        return chunks;
     }
     catch (const std::exception&)
     {
@@ -124,11 +200,10 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
     }
 }
 
-void SawyerChunkReader::ReadChunk(void* dst, size_t length)
+static void CopyChunkData(const SawyerChunk& chunk, void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
+    auto chunkData = static_cast<const uint8_t*>(chunk.GetData());
+    auto chunkLength = chunk.GetLength();
     if (chunkLength > length)
     {
         std::memcpy(dst, chunkData, length);
@@ -145,11 +220,33 @@ void SawyerChunkReader::ReadChunk(void* dst, size_t length)
     }
 }
 
-static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
+void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    MemoryStream buf;
+    auto chunk = ReadChunk();
+    CopyChunkData(*chunk, dst, length);
+}
 
-    auto src8 = static_cast<const uint8_t*>(src);
+void SawyerChunkReader::ReadChunks(std::initializer_list<SawyerChunkDestination> destinations)
+{
+    auto chunks = ReadChunks(destinations.size());
+    auto chunk = chunks.begin();
+    for (const auto& destination : destinations)
+    {
+        CopyChunkData(**chunk, destination.Data, destination.Length);
+        chunk++;
+    }
+}
+
+// Allocates a stream of exactly the decoded length, the decoders fill it in place through dst instead of growing it
+static MemoryStream AllocateDecodeBuffer(size_t length, uint8_t*& dst)
+{
+    dst = Memory::Allocate<uint8_t>(length);
+    return MemoryStream(dst, length, MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE | MEMORY_ACCESS::OWNER);
+}
+
+static size_t GetDecodedLengthRLE(const uint8_t* src8, size_t srcLength)
+{
+    size_t length = 0;
     for (size_t i = 0; i < srcLength; i++)
     {
         uint8_t rleCodeByte = src8[i];
@@ -162,15 +259,11 @@ static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
-            if (buf.GetLength() + count > MAX_UNCOMPRESSED_CHUNK_SIZE)
+            if (length + count > MAX_UNCOMPRESSED_CHUNK_SIZE)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
-
-            for (size_t n = 0; n < count; n++)
-            {
-                buf.Write1(src8 + i);
-            }
+            length += count;
         }
         else
         {
@@ -180,7 +273,7 @@ static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
-            if (buf.GetLength() + len > MAX_UNCOMPRESSED_CHUNK_SIZE)
+            if (length + len > MAX_UNCOMPRESSED_CHUNK_SIZE)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
@@ -188,10 +281,40 @@ static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
+            length += len;
+            i += len;
+        }
+    }
+    return length;
+}
 
-            const auto* pos = src8 + i + 1;
+static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
+{
+    // The first pass validates the codes and sizes the output, so runs can be emitted in bulk without bounds checks
+    auto src8 = static_cast<const uint8_t*>(src);
+    auto length = GetDecodedLengthRLE(src8, srcLength);
+    if (length == 0)
+    {
+        return MemoryStream();
+    }
 
-            buf.Write(pos, len);
+    uint8_t* dst;
+    auto buf = AllocateDecodeBuffer(length, dst);
+    for (size_t i = 0; i < srcLength; i++)
+    {
+        uint8_t rleCodeByte = src8[i];
+        if (rleCodeByte & 128)
+        {
+            i++;
+            size_t count = 257 - rleCodeByte;
+            std::memset(dst, src8[i], count);
+            dst += count;
+        }
+        else
+        {
+            const auto len = rleCodeByte + 1;
+            std::memcpy(dst, src8 + i + 1, len);
+            dst += len;
             i += len;
         }
     }
@@ -199,11 +322,9 @@ static MemoryStream DecodeChunkRLE(const void* src, size_t srcLength)
     return buf;
 }
 
-static MemoryStream DecodeChunkRepeat(const void* src, size_t srcLength)
+static size_t GetDecodedLengthRepeat(const uint8_t* src8, size_t srcLength)
 {
-    MemoryStream buf;
-
-    auto src8 = static_cast<const uint8_t*>(src);
+    size_t length = 0;
     for (size_t i = 0; i < srcLength; i++)
     {
         if (src8[i] == 0xFF)
@@ -213,25 +334,48 @@ static MemoryStream DecodeChunkRepeat(const void* src, size_t srcLength)
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
             i++;
-            buf.Write1(src8 + i);
+            length++;
+        }
+        else
+        {
+            length += (src8[i] & 7) + 1;
+        }
+    }
+    return length;
+}
+
+static MemoryStream DecodeChunkRepeat(const void* src, size_t srcLength)
+{
+    auto src8 = static_cast<const uint8_t*>(src);
+    auto length = GetDecodedLengthRepeat(src8, srcLength);
+    if (length == 0)
+    {
+        return MemoryStream();
+    }
+
+    uint8_t* dst;
+    auto buf = AllocateDecodeBuffer(length, dst);
+    const uint8_t* dstStart = dst;
+    for (size_t i = 0; i < srcLength; i++)
+    {
+        if (src8[i] == 0xFF)
+        {
+            i++;
+            *dst++ = src8[i];
         }
         else
         {
             size_t count = (src8[i] & 7) + 1;
             int32_t offset = static_cast<int32_t>(src8[i] >> 3) - 32;
-            const uint8_t* copySrc = static_cast<const uint8_t*>(buf.GetData()) + (buf.GetLength() + offset);
 
-            if (copySrc < static_cast<const uint8_t*>(buf.GetData())
-                || copySrc + count > static_cast<const uint8_t*>(buf.GetData()) + buf.GetLength())
+            // The copy has to come entirely from what has already been decoded
+            if (static_cast<size_t>(-offset) > static_cast<size_t>(dst - dstStart) || count > static_cast<size_t>(-offset))
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
 
-            // We need a temporary buffer as the vector might invalidate the pointer.
-            uint8_t temp[16];
-            std::memcpy(temp, copySrc, count);
-
-            buf.Write(temp, count);
+            std::memcpy(dst, dst + offset, count);
+            dst += count;
         }
     }
 
@@ -246,15 +390,19 @@ static MemoryStream DecodeChunkRLERepeat(const void* src, size_t srcLength)
 
 static MemoryStream DecodeChunkRotate(const void* src, size_t srcLength)
 {
-    MemoryStream buf;
+    if (srcLength == 0)
+    {
+        return MemoryStream();
+    }
 
+    uint8_t* dst;
+    auto buf = AllocateDecodeBuffer(srcLength, dst);
     auto src8 = static_cast<const uint8_t*>(src);
 
     uint8_t code = 1;
     for (size_t i = 0; i < srcLength; i++)
     {
-        uint8_t temp = Numerics::ror8(src8[i], code);
-        buf.Write1(&temp);
+        dst[i] = Numerics::ror8(src8[i], code);
         code = (code + 2) % 8;
     }
 
@@ -14,6 +14,7 @@
 #include "SawyerChunk.h"
 
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <vector>
 
@@ -35,6 +36,15 @@ namespace OpenRCT2
     struct IStream;
 }
 
+/**
+ * A buffer to read a chunk into, see SawyerChunkReader::ReadChunk(void*, size_t).
+ */
+struct SawyerChunkDestination
+{
+    void* Data;
+    size_t Length;
+};
+
 /**
  * Reads sawyer encoding chunks from a data stream. This can be used to read
  * SC6, SV6 and RCT2 objects. persistentChunks is a hint to the reader that the chunk will be preserved,
@@ -45,6 +55,8 @@ class SawyerChunkReader final
 private:
     OpenRCT2::IStream* const _stream = nullptr;
 
+    std::unique_ptr<uint8_t[]> ReadCompressedChunk(SawyerCodingChunkHeader& header);
+
 public:
     explicit SawyerChunkReader(OpenRCT2::IStream* stream);
 
@@ -64,6 +76,12 @@ public:
      */
     [[nodiscard]] std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
+    /**
+     * Reads the next count chunks from the stream. The compressed data is read in order, the chunks are then decoded in
+     * parallel which pays off for files with several large chunks such as the tile elements and entities of a park.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<SawyerChunk>> ReadChunks(size_t count);
+
     /**
      * Reads the next chunk from the stream and copies it directly to the
      * destination buffer. If the chunk is larger than length, only length
@@ -74,6 +92,12 @@ public:
      */
     void ReadChunk(void* dst, size_t length);
 
+    /**
+     * Reads the next chunks from the stream into the given destination buffers, decoding them in parallel. Each chunk
+     * is copied and padded the same way as ReadChunk(void*, size_t) does.
+     */
+    void ReadChunks(std::initializer_list<SawyerChunkDestination> destinations);
+
     /**
      * Reads the next chunk from the stream into a buffer returned as the
      * specified type. If the chunk is smaller than the size of the type
@@ -189,24 +189,33 @@ namespace OpenRCT2::RCT2
 
             chunkReader.ReadChunk(&_s6.Objects, sizeof(_s6.Objects));
 
+            // The remaining chunks are decoded in parallel, the tile elements and entities make up most of the file
             if (isScenario)
             {
-                chunkReader.ReadChunk(&_s6.ElapsedMonths, 16);
-                chunkReader.ReadChunk(&_s6.TileElements, sizeof(_s6.TileElements));
-                ReadChunk6(chunkReader, 76);
-                chunkReader.ReadChunk(&_s6.GuestsInPark, 4);
-                chunkReader.ReadChunk(&_s6.LastGuestsInPark, 8);
-                chunkReader.ReadChunk(&_s6.ParkRating, 2);
-                chunkReader.ReadChunk(&_s6.ActiveResearchTypes, 1082);
-                chunkReader.ReadChunk(&_s6.CurrentExpenditure, 16);
-                chunkReader.ReadChunk(&_s6.ParkValue, 4);
-                chunkReader.ReadChunk(&_s6.CompletedCompanyValue, 483816);
+                auto chunk6 = CreateChunk6Buffer(76);
+                chunkReader.ReadChunks({
+                    { &_s6.ElapsedMonths, 16 },
+                    { &_s6.TileElements, sizeof(_s6.TileElements) },
+                    { chunk6.data(), chunk6.size() },
+                    { &_s6.GuestsInPark, 4 },
+                    { &_s6.LastGuestsInPark, 8 },
+                    { &_s6.ParkRating, 2 },
+                    { &_s6.ActiveResearchTypes, 1082 },
+                    { &_s6.CurrentExpenditure, 16 },
+                    { &_s6.ParkValue, 4 },
+                    { &_s6.CompletedCompanyValue, 483816 },
+                });
+                ReadChunk6(chunk6, 76);
             }
             else
             {
-                chunkReader.ReadChunk(&_s6.ElapsedMonths, 16);
-                chunkReader.ReadChunk(&_s6.TileElements, sizeof(_s6.TileElements));
-                ReadChunk6(chunkReader, 488816);
+                auto chunk6 = CreateChunk6Buffer(488816);
+                chunkReader.ReadChunks({
+                    { &_s6.ElapsedMonths, 16 },
+                    { &_s6.TileElements, sizeof(_s6.TileElements) },
+                    { chunk6.data(), chunk6.size() },
+                });
+                ReadChunk6(chunk6, 488816);
             }
 
             _isScenario = isScenario;
@@ -215,12 +224,15 @@ namespace OpenRCT2::RCT2
             return ParkLoadResult(GetRequiredObjects());
         }
 
-        void ReadChunk6(SawyerChunkReader& chunkReader, uint32_t sizeWithoutEntities)
+        std::vector<uint8_t> CreateChunk6Buffer(uint32_t sizeWithoutEntities)
+        {
+            uint32_t entitiesSize = GetMaxEntities() * sizeof(Entity);
+            return std::vector<uint8_t>(sizeWithoutEntities + entitiesSize);
+        }
+
+        void ReadChunk6(std::vector<uint8_t>& buffer, uint32_t sizeWithoutEntities)
         {
             uint32_t entitiesSize = GetMaxEntities() * sizeof(Entity);
-            size_t bufferSize = sizeWithoutEntities + entitiesSize;
-            std::vector<uint8_t> buffer(bufferSize);
-            chunkReader.ReadChunk(buffer.data(), buffer.size());
             auto stream = OpenRCT2::MemoryStream(buffer.data(), buffer.size());
 
             uint32_t preEntitiesSize = sizeof(_s6.NextFreeTileElementPointerIndex);
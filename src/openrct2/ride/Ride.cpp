@@ -45,6 +45,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/RideObject.h"
 #include "../object/StationObject.h"
+#include "../peep/PathDistanceField.h"
 #include "../profiling/Profiling.h"
 #include "../rct1/RCT1.h"
 #include "../scenario/Scenario.h"
@@ -119,7 +120,7 @@ struct StationIndexWithMessage
 };
 
 // Static function declarations
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection);
+Staff* FindClosestMechanic(const Ride& ride, const CoordsXY& entrancePosition, int32_t forInspection);
 static void RideBreakdownStatusUpdate(Ride& ride);
 static void RideBreakdownUpdate(Ride& ride);
 static void RideCallClosestMechanic(Ride& ride);
@@ -1793,7 +1794,7 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
     // Set x,y to centre of the station exit for the mechanic search.
     auto centreMapLocation = mapLocation.ToTileCentre();
 
-    return FindClosestMechanic(centreMapLocation, forInspection);
+    return FindClosestMechanic(ride, centreMapLocation, forInspection);
 }
 
 /**
@@ -1801,9 +1802,10 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
  *  rct2: 0x006B774B (forInspection = 0)
  *  rct2: 0x006B78C3 (forInspection = 1)
  */
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection)
+Staff* FindClosestMechanic(const Ride& ride, const CoordsXY& entrancePosition, int32_t forInspection)
 {
     Staff* closestMechanic = nullptr;
+    uint16_t closestPathDistance = PathFinding::kPathDistanceUnreachable;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
     for (auto peep : EntityList<Staff>())
@@ -1838,10 +1840,18 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
         if (peep->x == kLocationNull)
             continue;
 
-        // Manhattan distance
+        // Prefer the mechanic with the shortest walk along the paths, then the shortest Manhattan distance for those
+        // that are not connected to the station by paths.
+        uint16_t pathDistance = PathFinding::kPathDistanceUnreachable;
+        if (!peep->GetNextIsSurface())
+        {
+            pathDistance = PathFinding::GetStationExitPathDistance(
+                ride, ride.inspection_station, TileCoordsXYZ{ peep->NextLoc });
+        }
         uint32_t distance = std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
-        if (distance < closestDistance)
+        if (pathDistance < closestPathDistance || (pathDistance == closestPathDistance && distance < closestDistance))
         {
+            closestPathDistance = pathDistance;
             closestDistance = distance;
             closestMechanic = peep;
         }
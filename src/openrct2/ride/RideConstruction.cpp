@@ -21,6 +21,7 @@
 #include "../core/FixedVector.h"
 #include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestStatistics.h"
 #include "../entity/Staff.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatter.h"
@@ -303,6 +304,7 @@ void Ride::RemovePeeps()
             peep->Happiness = std::min(peep->Happiness, peep->HappinessTarget) / 2;
             peep->HappinessTarget = peep->Happiness;
             peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
+            GuestStatistics::UpdateGuest(*peep);
         }
     }
     // Place all the staff at exit
@@ -9,6 +9,8 @@
 
 #include "TrackDesign.h"
 
+#include "../AssetPack.h"
+#include "../AssetPackManager.h"
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../Diagnostic.h"
@@ -16,6 +18,7 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../TrackImporter.h"
+#include "../Version.h"
 #include "../actions/FootpathLayoutPlaceAction.h"
 #include "../actions/FootpathRemoveAction.h"
 #include "../actions/LargeSceneryPlaceAction.h"
@@ -31,8 +34,10 @@
 #include "../actions/WallPlaceAction.h"
 #include "../actions/WallRemoveAction.h"
 #include "../audio/audio.h"
+#include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
+#include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 #include "../core/String.hpp"
 #include "../drawing/X8DrawingEngine.h"
@@ -64,6 +69,7 @@
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesign.h"
+#include "TrackDesignPreviewCache.h"
 #include "TrackDesignRepository.h"
 #include "Vehicle.h"
 
@@ -99,6 +105,8 @@ bool _trackDesignPlaceStateSceneryUnavailable = false;
 static bool _trackDesignPlaceStateEntranceExitPlaced{};
 
 static void TrackDesignPreviewClearMap();
+static uint64_t TrackDesignGetPreviewCacheKey(const TrackDesign& td, const std::vector<uint8_t>& fileData);
+static void TrackDesignDrawPreviewWithObjectsLoaded(TrackDesign& td, uint8_t* pixels);
 
 static u8string_view TrackDesignGetStationObjectIdentifier(const Ride& ride)
 {
@@ -2055,14 +2063,134 @@ bool TrackDesignSceneryElement::operator!=(const TrackDesignSceneryElement& rhs)
  */
 void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels)
 {
-    StashMap();
-    TrackDesignPreviewClearMap();
+    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
+    {
+        TrackDesignLoadSceneryObjects(td);
+    }
+    TrackDesignDrawPreviewWithObjectsLoaded(td, pixels);
+}
 
+bool TrackDesignDrawPreviewCached(TrackDesign& td, u8string_view path, uint8_t* pixels)
+{
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
     {
         TrackDesignLoadSceneryObjects(td);
     }
 
+    uint64_t key{};
+    try
+    {
+        key = TrackDesignGetPreviewCacheKey(td, File::ReadAllBytes(path));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to hash track design %s: %s", u8string(path).c_str(), e.what());
+        TrackDesignDrawPreviewWithObjectsLoaded(td, pixels);
+        return false;
+    }
+
+    TrackDesignPreviewCache::Entry entry;
+    if (TrackDesignPreviewCache::Get(key, entry))
+    {
+        td.gameStateData.flags = entry.Flags;
+        td.gameStateData.cost = entry.Cost;
+        std::copy(entry.Pixels.begin(), entry.Pixels.end(), pixels);
+        return true;
+    }
+
+    TrackDesignDrawPreviewWithObjectsLoaded(td, pixels);
+    entry.Flags = td.gameStateData.flags;
+    entry.Cost = td.gameStateData.cost;
+    entry.Pixels.assign(pixels, pixels + 4 * kTrackPreviewImageSize);
+    TrackDesignPreviewCache::Set(key, entry);
+    return false;
+}
+
+/**
+ * Writes which object is loaded rather than the slot it is loaded in, so the key is the same in every park and changes
+ * whenever an object is updated.
+ */
+static void TrackDesignWritePreviewCacheObject(MemoryStream& stream, const Object* obj)
+{
+    stream.WriteValue(obj != nullptr);
+    if (obj != nullptr)
+    {
+        const auto& [major, minor, patch] = obj->GetVersion();
+        stream.WriteString(obj->GetDescriptor().ToString());
+        stream.WriteValue(major);
+        stream.WriteValue(minor);
+        stream.WriteValue(patch);
+    }
+}
+
+/**
+ * Besides the design itself, the preview depends on which of the objects it uses are loaded and invented, on the
+ * scenery toggle, on the enabled asset packs and on the game drawing it. These are hashed along with the design file
+ * so that previews drawn with something else are never shown.
+ */
+static uint64_t TrackDesignGetPreviewCacheKey(const TrackDesign& td, const std::vector<uint8_t>& fileData)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    const auto& gameState = GetGameState();
+
+    MemoryStream environment;
+    environment.WriteString(gVersionInfoFull);
+
+    auto* assetPackManager = GetContext()->GetAssetPackManager();
+    if (assetPackManager != nullptr)
+    {
+        // Packs later in the list take precedence, so the order matters as well
+        for (size_t i = 0; i < assetPackManager->GetCount(); i++)
+        {
+            const auto* assetPack = assetPackManager->GetAssetPack(i);
+            if (assetPack != nullptr && assetPack->IsEnabled())
+            {
+                environment.WriteString(assetPack->Id);
+                environment.WriteString(assetPack->Version);
+            }
+        }
+    }
+
+    const auto vehicleEntryIndex = objManager.GetLoadedObjectEntryIndex(td.trackAndVehicle.vehicleObject);
+    TrackDesignWritePreviewCacheObject(environment, objManager.GetLoadedObject(td.trackAndVehicle.vehicleObject));
+    environment.WriteValue(vehicleEntryIndex != OBJECT_ENTRY_INDEX_NULL && RideEntryIsInvented(vehicleEntryIndex));
+    const auto stationEntryIndex = objManager.GetLoadedObjectEntryIndex(td.appearance.stationObjectIdentifier);
+    TrackDesignWritePreviewCacheObject(environment, objManager.GetLoadedObject(ObjectType::Station, stationEntryIndex));
+    TrackDesignWritePreviewCacheObject(
+        environment, objManager.GetLoadedObject(ObjectType::Station, gameState.LastEntranceStyle));
+    environment.WriteValue(gameState.Cheats.IgnoreResearchStatus);
+    environment.WriteValue(gTrackDesignSceneryToggle);
+    environment.WriteValue((gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) != 0);
+
+    // Looking up the scenery entries flags missing scenery as a side effect, which must not leak into placement
+    const auto sceneryUnavailable = _trackDesignPlaceStateSceneryUnavailable;
+    for (const auto& scenery : td.sceneryElements)
+    {
+        const auto entry = TrackDesignPlaceSceneryElementGetEntry(scenery);
+        environment.WriteValue(entry.has_value());
+        if (entry.has_value())
+        {
+            TrackDesignWritePreviewCacheObject(environment, objManager.GetLoadedObject(entry->Type, entry->Index));
+            TrackDesignWritePreviewCacheObject(
+                environment, objManager.GetLoadedObject(ObjectType::FootpathRailings, entry->SecondaryIndex));
+        }
+    }
+    _trackDesignPlaceStateSceneryUnavailable = sceneryUnavailable;
+
+    const auto hash = Crypt::CreateFNV1a()
+                          ->Update(fileData.data(), fileData.size())
+                          ->Update(environment.GetData(), environment.GetLength())
+                          ->Finish();
+    uint64_t key;
+    std::memcpy(&key, hash.data(), sizeof(key));
+    return key;
+}
+
+static void TrackDesignDrawPreviewWithObjectsLoaded(TrackDesign& td, uint8_t* pixels)
+{
+    StashMap();
+    TrackDesignPreviewClearMap();
+
     TrackDesignState tds{};
 
     Ride* ride;
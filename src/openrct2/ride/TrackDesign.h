@@ -247,6 +247,12 @@ int32_t TrackDesignGetZPlacement(const TrackDesign& td, Ride& ride, const Coords
 ///////////////////////////////////////////////////////////////////////////////
 void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels);
 
+/**
+ * Draws the preview of the design loaded from the given path like TrackDesignDrawPreview, unless the preview cache has a
+ * copy drawn from the same file with the same objects available. Returns true if the preview came from the cache.
+ */
+bool TrackDesignDrawPreviewCached(TrackDesign& td, u8string_view path, uint8_t* pixels);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
 ///////////////////////////////////////////////////////////////////////////////
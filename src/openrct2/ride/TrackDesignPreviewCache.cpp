@@ -0,0 +1,205 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignPreviewCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/File.h"
+#include "../core/FileSystem.hpp"
+#include "../core/Guard.hpp"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+#include "../util/Util.h"
+#include "TrackDesign.h"
+
+#include <algorithm>
+#include <list>
+#include <utility>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace OpenRCT2::TrackDesignPreviewCache
+{
+    static constexpr uint32_t kMagicNumber = 0x56504454; // TDPV
+    static constexpr uint16_t kVersion = 1;
+    static constexpr size_t kPixelsLength = 4 * kTrackPreviewImageSize;
+
+    // Enough to flick between the neighbours of the selected design without going to disk
+    static constexpr size_t kMaxMemoryEntries = 8;
+
+    // A few megabytes of previews, several design libraries' worth
+    static constexpr size_t kMaxDiskEntries = 1024;
+    // Listing the directory gets slower as it fills up, so it is only done every so many writes
+    static constexpr size_t kWritesBetweenDiskTrims = kMaxDiskEntries / 4;
+    static size_t _writesUntilDiskTrim = 0;
+
+    // Most recently used first
+    static std::list<std::pair<uint64_t, Entry>> _memoryEntries;
+
+    static u8string GetDirectoryPath()
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"trackpreviews");
+    }
+
+    static u8string GetEntryPath(uint64_t key)
+    {
+        char fileName[32];
+        snprintf(fileName, sizeof(fileName), "%016llx.dat", static_cast<unsigned long long>(key));
+        return Path::Combine(GetDirectoryPath(), fileName);
+    }
+
+    /**
+     * Removes the least recently used previews from the cache directory once there are more than kMaxDiskEntries, down
+     * to three quarters of that so the next trims are not needed straight away.
+     */
+    static void TrimDisk()
+    {
+        std::vector<std::pair<fs::file_time_type, fs::path>> files;
+        std::error_code ec;
+        for (const auto& dirEntry : fs::directory_iterator(fs::u8path(GetDirectoryPath()), ec))
+        {
+            if (dirEntry.is_regular_file(ec) && dirEntry.path().extension() == ".dat")
+            {
+                files.emplace_back(dirEntry.last_write_time(ec), dirEntry.path());
+            }
+        }
+        if (files.size() <= kMaxDiskEntries)
+        {
+            return;
+        }
+
+        std::sort(files.begin(), files.end());
+        const auto numToRemove = files.size() - (kMaxDiskEntries * 3 / 4);
+        for (size_t i = 0; i < numToRemove; i++)
+        {
+            fs::remove(files[i].second, ec);
+        }
+    }
+
+    static void AddToMemory(uint64_t key, const Entry& entry)
+    {
+        _memoryEntries.emplace_front(key, entry);
+        if (_memoryEntries.size() > kMaxMemoryEntries)
+        {
+            _memoryEntries.pop_back();
+        }
+    }
+
+    static bool ReadFromDisk(uint64_t key, Entry& entry)
+    {
+        const auto path = GetEntryPath(key);
+        if (!File::Exists(path))
+        {
+            return false;
+        }
+
+        try
+        {
+            const auto data = File::ReadAllBytes(path);
+            MemoryStream stream(data.data(), data.size());
+            if (stream.ReadValue<uint32_t>() != kMagicNumber || stream.ReadValue<uint16_t>() != kVersion)
+            {
+                return false;
+            }
+
+            entry.Flags = stream.ReadValue<uint8_t>();
+            entry.Cost = stream.ReadValue<money64>();
+            const auto compressedLength = stream.ReadValue<uint32_t>();
+            if (compressedLength > stream.GetLength() - stream.GetPosition())
+            {
+                return false;
+            }
+
+            entry.Pixels = Ungzip(data.data() + stream.GetPosition(), compressedLength);
+            if (entry.Pixels.size() != kPixelsLength)
+            {
+                return false;
+            }
+
+            // The write time marks how recently a preview was used, which decides the order they are removed in
+            std::error_code ec;
+            fs::last_write_time(fs::u8path(path), fs::file_time_type::clock::now(), ec);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to read track design preview %s: %s", path.c_str(), e.what());
+            return false;
+        }
+    }
+
+    static void WriteToDisk(uint64_t key, const Entry& entry)
+    {
+        const auto path = GetEntryPath(key);
+        try
+        {
+            // Previews are mostly transparent, so they compress to a few kilobytes each
+            const auto compressed = Gzip(entry.Pixels.data(), entry.Pixels.size());
+
+            MemoryStream stream;
+            stream.WriteValue(kMagicNumber);
+            stream.WriteValue(kVersion);
+            stream.WriteValue(entry.Flags);
+            stream.WriteValue(entry.Cost);
+            stream.WriteValue(static_cast<uint32_t>(compressed.size()));
+            stream.Write(compressed.data(), compressed.size());
+
+            Path::CreateDirectory(Path::GetDirectory(path));
+            File::WriteAllBytes(path, stream.GetData(), stream.GetLength());
+
+            if (_writesUntilDiskTrim == 0)
+            {
+                TrimDisk();
+                _writesUntilDiskTrim = kWritesBetweenDiskTrims;
+            }
+            _writesUntilDiskTrim--;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to write track design preview %s: %s", path.c_str(), e.what());
+        }
+    }
+
+    bool Get(uint64_t key, Entry& entry)
+    {
+        for (auto it = _memoryEntries.begin(); it != _memoryEntries.end(); it++)
+        {
+            if (it->first == key)
+            {
+                _memoryEntries.splice(_memoryEntries.begin(), _memoryEntries, it);
+                entry = it->second;
+                return true;
+            }
+        }
+
+        if (ReadFromDisk(key, entry))
+        {
+            AddToMemory(key, entry);
+            return true;
+        }
+        return false;
+    }
+
+    void Set(uint64_t key, const Entry& entry)
+    {
+        Guard::Assert(entry.Pixels.size() == kPixelsLength, "Track design preview has the wrong size");
+
+        AddToMemory(key, entry);
+        WriteToDisk(key, entry);
+    }
+
+    void ClearMemory()
+    {
+        _memoryEntries.clear();
+    }
+} // namespace OpenRCT2::TrackDesignPreviewCache
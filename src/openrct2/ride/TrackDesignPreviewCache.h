@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/Money.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Stores drawn track design previews, all four rotations of them together with the placement results shown next to them,
+ * so that browsing a design library only draws each design once. The most recently used previews are kept in memory,
+ * and many more of them are kept compressed in the cache directory, where the least recently used are removed once
+ * there are too many.
+ */
+namespace OpenRCT2::TrackDesignPreviewCache
+{
+    struct Entry
+    {
+        uint8_t Flags{};
+        money64 Cost{};
+        std::vector<uint8_t> Pixels;
+    };
+
+    /**
+     * Gets the preview stored under the given key, first from memory and then from disk.
+     * Returns false if there is none or if the stored one can not be read.
+     */
+    bool Get(uint64_t key, Entry& entry);
+
+    /**
+     * Stores a preview under the given key, in memory and on disk. Old previews are removed from disk every so often.
+     */
+    void Set(uint64_t key, const Entry& entry);
+
+    /**
+     * Drops the previews kept in memory, the ones on disk are kept.
+     */
+    void ClearMemory();
+} // namespace OpenRCT2::TrackDesignPreviewCache
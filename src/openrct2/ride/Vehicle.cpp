@@ -60,6 +60,7 @@
 
 #include <cassert>
 #include <iterator>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Audio;
@@ -6576,21 +6577,13 @@ bool Vehicle::UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* oth
             if (vehicle2 == this)
                 continue;
 
+            // Every check up to the car entry lookup only reads the two vehicles, so the cheap distance checks are
+            // done first to reject most of the cars on a busy circuit without looking up their ride object.
             int32_t z_diff = abs(vehicle2->z - loc.z);
 
             if (z_diff > 16)
                 continue;
 
-            if (vehicle2->IsCableLift())
-                continue;
-
-            auto collideCarEntry = vehicle2->Entry();
-            if (collideCarEntry == nullptr)
-                continue;
-
-            if (!(collideCarEntry->flags & CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
-                continue;
-
             uint32_t x_diff = abs(vehicle2->x - loc.x);
             if (x_diff > 0x7FFF)
                 continue;
@@ -6599,6 +6592,12 @@ bool Vehicle::UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* oth
             if (y_diff > 0x7FFF)
                 continue;
 
+            uint32_t ecx = var_44 + vehicle2->var_44;
+            ecx = ((ecx >> 1) * 30) >> 8;
+
+            if (x_diff + y_diff >= ecx)
+                continue;
+
             VehicleTrackSubposition cl = std::min(TrackSubposition, vehicle2->TrackSubposition);
             VehicleTrackSubposition ch = std::max(TrackSubposition, vehicle2->TrackSubposition);
             if (cl != ch)
@@ -6607,10 +6606,14 @@ bool Vehicle::UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* oth
                     continue;
             }
 
-            uint32_t ecx = var_44 + vehicle2->var_44;
-            ecx = ((ecx >> 1) * 30) >> 8;
+            if (vehicle2->IsCableLift())
+                continue;
 
-            if (x_diff + y_diff >= ecx)
+            auto collideCarEntry = vehicle2->Entry();
+            if (collideCarEntry == nullptr)
+                continue;
+
+            if (!(collideCarEntry->flags & CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
                 continue;
 
             if (!(collideCarEntry->flags & CAR_ENTRY_FLAG_GO_KART))
@@ -6878,6 +6881,157 @@ void Vehicle::PopulateBrakeSpeed(const CoordsXYZ& vehicleTrackLocation, TrackEle
     BlockBrakeSpeed = trackSpeed;
 }
 
+/**
+ * A track element found by one of the cached lookups below, along with enough of the element to recognise it again.
+ */
+struct VehicleTrackPiece
+{
+    TileElement* Element{};
+    uint8_t BaseHeight{};
+    track_type_t TrackType{};
+    uint8_t Sequence{};
+    RideId Ride{};
+
+    VehicleTrackPiece() = default;
+    explicit VehicleTrackPiece(TileElement* element)
+        : Element(element)
+    {
+        if (element != nullptr)
+        {
+            const auto* trackElement = element->AsTrack();
+            BaseHeight = element->BaseHeight;
+            TrackType = trackElement->GetTrackType();
+            Sequence = trackElement->GetSequenceIndex();
+            Ride = trackElement->GetRideIndex();
+        }
+    }
+
+    /**
+     * Placing or removing a ghost moves the other elements of its tile, and may move the whole element list, without
+     * changing the tile elements revision. Element is only read once it is found among the elements of its tile.
+     */
+    bool IsCurrent(const CoordsXY& location) const
+    {
+        auto* tileElement = MapGetFirstElementAt(location);
+        if (tileElement == nullptr)
+            return false;
+        do
+        {
+            if (tileElement != Element)
+                continue;
+
+            const auto* trackElement = tileElement->AsTrack();
+            return trackElement != nullptr && !tileElement->IsGhost() && tileElement->BaseHeight == BaseHeight
+                && trackElement->GetTrackType() == TrackType && trackElement->GetSequenceIndex() == Sequence
+                && trackElement->GetRideIndex() == Ride;
+        } while (!(tileElement++)->IsLastForTile());
+        return false;
+    }
+};
+
+/**
+ * The track pieces around a piece a vehicle is on, as found by the tile lookups done when a car moves onto a new piece.
+ * Every car of every train passes the same pieces each lap, so the results are kept until the tile elements revision
+ * changes. Each element is checked to still be in place before it is used, and looked up again if it moved.
+ */
+struct VehicleTrackLinks
+{
+    // The first element of the piece, nullptr if there is none
+    VehicleTrackPiece Piece{};
+    bool NextResolved{};
+    bool HasNext{};
+    CoordsXYE Next{};
+    VehicleTrackPiece NextPiece{};
+    int32_t NextZ{};
+    int32_t NextDirection{};
+    bool PreviousResolved{};
+    bool HasPrevious{};
+    TrackBeginEnd Previous{};
+    VehicleTrackPiece PreviousPiece{};
+};
+
+static std::unordered_map<uint64_t, VehicleTrackLinks> _vehicleTrackLinks;
+static uint32_t _vehicleTrackLinksRevision;
+
+static VehicleTrackLinks& VehicleGetTrackLinks(const CoordsXYZ& location, track_type_t trackType)
+{
+    const auto revision = MapGetTileElementsRevision();
+    if (_vehicleTrackLinksRevision != revision)
+    {
+        _vehicleTrackLinks.clear();
+        _vehicleTrackLinksRevision = revision;
+    }
+
+    const auto key = (static_cast<uint64_t>(static_cast<uint16_t>(location.x)) << 48)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.y)) << 32)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.z)) << 16) | trackType;
+    auto [it, inserted] = _vehicleTrackLinks.try_emplace(key);
+    auto& links = it->second;
+    if (!inserted && links.Piece.Element != nullptr && !links.Piece.IsCurrent(location))
+    {
+        links = {};
+        inserted = true;
+    }
+    if (inserted)
+    {
+        links.Piece = VehicleTrackPiece(MapGetTrackElementAtOfTypeSeq(location, trackType, 0));
+    }
+    return links;
+}
+
+static bool VehicleGetNextTrack(
+    VehicleTrackLinks& links, const CoordsXY& location, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    if (!links.NextResolved || (links.HasNext && !links.NextPiece.IsCurrent(links.Next)))
+    {
+        CoordsXYE input = { location, links.Piece.Element };
+        links.HasNext = TrackBlockGetNext(&input, &links.Next, &links.NextZ, &links.NextDirection);
+        links.NextPiece = VehicleTrackPiece(links.HasNext ? links.Next.element : nullptr);
+        links.NextResolved = true;
+    }
+    *output = links.Next;
+    *z = links.NextZ;
+    *direction = links.NextDirection;
+    return links.HasNext;
+}
+
+static bool VehicleGetPreviousTrack(VehicleTrackLinks& links, const CoordsXY& location, TrackBeginEnd* output)
+{
+    if (!links.PreviousResolved
+        || (links.HasPrevious
+            && !links.PreviousPiece.IsCurrent({ links.Previous.begin_x, links.Previous.begin_y })))
+    {
+        links.HasPrevious = TrackBlockGetPrevious({ location, links.Piece.Element }, &links.Previous);
+        links.PreviousPiece = VehicleTrackPiece(links.HasPrevious ? links.Previous.begin_element : nullptr);
+        links.PreviousResolved = true;
+    }
+    *output = links.Previous;
+    return links.HasPrevious;
+}
+
+bool VehicleGetTrackNeighbours(
+    const CoordsXYZ& location, track_type_t trackType, bool useCache, CoordsXYE& next, TrackBeginEnd& previous)
+{
+    int32_t z{};
+    int32_t direction{};
+    if (useCache)
+    {
+        auto& links = VehicleGetTrackLinks(location, trackType);
+        if (links.Piece.Element == nullptr)
+            return false;
+
+        const auto hasNext = VehicleGetNextTrack(links, location, &next, &z, &direction);
+        return VehicleGetPreviousTrack(links, location, &previous) && hasNext;
+    }
+
+    CoordsXYE input = { location, MapGetTrackElementAtOfTypeSeq(location, trackType, 0) };
+    if (input.element == nullptr)
+        return false;
+
+    const auto hasNext = TrackBlockGetNext(&input, &next, &z, &direction);
+    return TrackBlockGetPrevious(input, &previous) && hasNext;
+}
+
 /**
  *
  *  rct2: 0x006DB08C
@@ -6887,7 +7041,8 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
     CoordsXYZD location = {};
 
     auto pitchAndRollEnd = TrackPitchAndRollEnd(trackType);
-    TileElement* tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+    auto& trackLinks = VehicleGetTrackLinks(TrackLocation, trackType);
+    TileElement* tileElement = trackLinks.Piece.Element;
 
     if (tileElement == nullptr)
     {
@@ -6948,7 +7103,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
     if (isGoingBack)
     {
         TrackBeginEnd trackBeginEnd;
-        if (!TrackBlockGetPrevious({ TrackLocation, tileElement }, &trackBeginEnd))
+        if (!VehicleGetPreviousTrack(trackLinks, TrackLocation, &trackBeginEnd))
         {
             return false;
         }
@@ -6962,8 +7117,8 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
     {
         {
             int32_t curZ, direction;
-            CoordsXYE xyElement = { TrackLocation, tileElement };
-            if (!TrackBlockGetNext(&xyElement, &xyElement, &curZ, &direction))
+            CoordsXYE xyElement;
+            if (!VehicleGetNextTrack(trackLinks, TrackLocation, &xyElement, &curZ, &direction))
             {
                 return false;
             }
@@ -7313,7 +7468,8 @@ static PitchAndRoll PitchAndRollEnd(const Ride& curRide, bool useInvertedSprites
 bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ride& curRide, uint16_t* progress)
 {
     auto pitchAndRollStart = TrackPitchAndRollStart(trackType);
-    TileElement* tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+    auto& trackLinks = VehicleGetTrackLinks(TrackLocation, trackType);
+    TileElement* tileElement = trackLinks.Piece.Element;
 
     if (tileElement == nullptr)
         return false;
@@ -7347,7 +7503,7 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ri
     {
         // Loc6DBB7E:;
         TrackBeginEnd trackBeginEnd;
-        if (!TrackBlockGetPrevious({ trackPos, tileElement }, &trackBeginEnd))
+        if (!VehicleGetPreviousTrack(trackLinks, trackPos, &trackBeginEnd))
         {
             return false;
         }
@@ -7380,14 +7536,9 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ri
     else
     {
         // Loc6DBB4F:;
-        CoordsXYE input;
         CoordsXYE output;
         int32_t outputZ{};
-
-        input.x = trackPos.x;
-        input.y = trackPos.y;
-        input.element = tileElement;
-        if (!TrackBlockGetNext(&input, &output, &outputZ, &direction))
+        if (!VehicleGetNextTrack(trackLinks, trackPos, &output, &outputZ, &direction))
         {
             return false;
         }
@@ -30,6 +30,8 @@ struct RideObjectEntry;
 struct CarEntry;
 class DataSerialiser;
 struct PaintSession;
+struct CoordsXYE;
+struct TrackBeginEnd;
 
 struct GForces
 {
@@ -529,6 +531,13 @@ void VehicleUpdateAll();
 void VehicleSoundsUpdate();
 uint16_t VehicleGetMoveInfoSize(VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction);
 
+/**
+ * Finds the pieces before and after a piece the way cars do when they move onto it, either through the cache the track
+ * motion code uses or with fresh tile lookups. Returns false if the piece or either neighbour is missing.
+ */
+bool VehicleGetTrackNeighbours(
+    const CoordsXYZ& location, track_type_t trackType, bool useCache, CoordsXYE& next, TrackBeginEnd& previous);
+
 void RideUpdateMeasurementsSpecialElements_Default(Ride& ride, const track_type_t trackType);
 void RideUpdateMeasurementsSpecialElements_MiniGolf(Ride& ride, const track_type_t trackType);
 void RideUpdateMeasurementsSpecialElements_WaterCoaster(Ride& ride, const track_type_t trackType);
@@ -13,6 +13,7 @@
 
 #    include "../../../GameState.h"
 #    include "../../../entity/Guest.h"
+#    include "../../../entity/GuestStatistics.h"
 #    include "../../../localisation/Formatting.h"
 #    include "../../../peep/PeepAnimationData.h"
 #    include "../../../ride/RideEntry.h"
@@ -315,6 +316,7 @@ namespace OpenRCT2::Scripting
         if (peep != nullptr)
         {
             peep->Happiness = value;
+            GuestStatistics::UpdateGuest(*peep);
         }
     }
 
@@ -507,6 +509,7 @@ namespace OpenRCT2::Scripting
         if (peep != nullptr)
         {
             peep->GuestIsLostCountdown = value;
+            GuestStatistics::UpdateGuest(*peep);
         }
     }
 
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../entity/GuestStatistics.h"
 #    include "ScEntity.hpp"
 
 namespace OpenRCT2::Scripting
@@ -114,6 +115,10 @@ namespace OpenRCT2::Scripting
                     peep->PeepFlags |= mask;
                 else
                     peep->PeepFlags &= ~mask;
+                if (auto* guest = peep->As<Guest>(); guest != nullptr)
+                {
+                    GuestStatistics::UpdateGuest(*guest);
+                }
                 peep->Invalidate();
             }
         }
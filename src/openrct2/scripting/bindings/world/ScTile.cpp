@@ -126,6 +126,8 @@ namespace OpenRCT2::Scripting
                 }
             }
             MapInvalidateTileFull(_coords);
+            MapInvalidateTileContents(TileCoordsXY(_coords));
+            MapIncrementTileElementsRevision();
         }
     }
 
@@ -178,6 +180,7 @@ namespace OpenRCT2::Scripting
                 }
                 first[origNumElements].SetLastForTile(true);
                 MapInvalidateTileFull(_coords);
+                MapIncrementTileElementsRevision();
                 result = std::make_shared<ScTileElement>(_coords, &first[index]);
             }
         }
@@ -2146,6 +2146,8 @@ namespace OpenRCT2::Scripting
     void ScTileElement::Invalidate()
     {
         MapInvalidateTileFull(_coords);
+        MapInvalidateTileContents(TileCoordsXY(_coords));
+        MapIncrementTileElementsRevision();
     }
 
     const LargeSceneryElement* ScTileElement::GetOtherLargeSceneryElement(
@@ -232,14 +232,14 @@ static size_t DecodeChunkRLEWithSize(const uint8_t* src_buffer, uint8_t* dst_buf
         {
             i++;
             count = 257 - rleCodeByte;
-            assert(dst + count <= dst_buffer + dstSize);
-            assert(i < length);
+            if ((dst + count > dst_buffer + dstSize) || (i >= length))
+                throw std::out_of_range("Invalid RLE string!");
             std::fill_n(dst, count, src_buffer[i]);
             dst = reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(dst) + count);
         }
         else
         {
-            if ((dst + rleCodeByte + 1 > dst_buffer + dstSize) || (i + 1 >= length))
+            if ((dst + rleCodeByte + 1 > dst_buffer + dstSize) || (i + 1 + rleCodeByte + 1 > length))
                 throw std::out_of_range("Invalid RLE string!");
             std::memcpy(dst, src_buffer + i + 1, rleCodeByte + 1);
             dst = reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(dst) + rleCodeByte + 1);
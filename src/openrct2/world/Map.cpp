@@ -44,6 +44,7 @@
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
 #include "../scenario/Scenario.h"
+#include "../util/Prefetch.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/TilePointerIndex.hpp"
@@ -60,7 +61,10 @@
 #include "TileInspector.h"
 #include "Wall.h"
 
+#include <atomic>
+#include <chrono>
 #include <iterator>
+#include <limits>
 #include <memory>
 
 using namespace OpenRCT2;
@@ -107,6 +111,39 @@ static std::vector<TileElement> _tileElementsStash;
 static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
+static uint32_t _tileElementsRevision;
+static uint32_t _tileElementsRevisionStash;
+// Revisions are never handed out twice, so a revision restored by UnstashMap can not be mistaken for a later one
+static uint32_t _lastTileElementsRevision;
+
+// The map is split into row segments of 32 tiles that remember whether they contain any footpath, so that the wide
+// flag sweep can step over empty land and the unused space beyond the map edge without visiting every tile.
+static constexpr int32_t kMaintenanceRegionShift = 5;
+static constexpr int32_t kMaintenanceRegionSize = 1 << kMaintenanceRegionShift;
+static constexpr int32_t kMaintenanceRegionsPerRow = (kMaximumMapSizeTechnical + kMaintenanceRegionSize - 1)
+    >> kMaintenanceRegionShift;
+
+enum class MaintenanceRegionState : uint8_t
+{
+    Unknown,
+    NoPaths,
+    HasPaths,
+};
+
+static std::vector<MaintenanceRegionState> _maintenanceRegions;
+static MapMaintenanceStats _maintenanceStats;
+static uint32_t _maintenanceStatsTick;
+
+// Element types present on each tile, 0 until the tile has been looked at since it was last edited. Atomic as the
+// masks are filled in lazily and typed tile queries may run on paint or ride update worker threads.
+static std::unique_ptr<std::atomic<TileElementTypeMask>[]> _tileElementTypes;
+
+static void MapInvalidateAllTileContents()
+{
+    _maintenanceRegions.clear();
+    _tileElementTypes = std::make_unique<std::atomic<TileElementTypeMask>[]>(
+        kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+}
 
 void StashMap()
 {
@@ -115,6 +152,9 @@ void StashMap()
     _tileElementsStash = std::move(gameState.TileElements);
     _mapSizeStash = gameState.MapSize;
     _tileElementsInUseStash = _tileElementsInUse;
+    _tileElementsRevisionStash = _tileElementsRevision;
+    MapInvalidateAllTileContents();
+    MapIncrementTileElementsRevision();
 }
 
 void UnstashMap()
@@ -124,6 +164,37 @@ void UnstashMap()
     gameState.TileElements = std::move(_tileElementsStash);
     gameState.MapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    MapInvalidateAllTileContents();
+
+    // The map is back as it was, so results derived from it before it was stashed are still valid
+    _tileElementsRevision = _tileElementsRevisionStash;
+}
+
+uint32_t MapGetTileElementsRevision()
+{
+    return _tileElementsRevision;
+}
+
+void MapIncrementTileElementsRevision()
+{
+    _tileElementsRevision = ++_lastTileElementsRevision;
+}
+
+void MapInvalidateTileContents(const TileCoordsXY& tilePos)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+    {
+        return;
+    }
+    if (!_maintenanceRegions.empty())
+    {
+        _maintenanceRegions[tilePos.y * kMaintenanceRegionsPerRow + (tilePos.x >> kMaintenanceRegionShift)]
+            = MaintenanceRegionState::Unknown;
+    }
+    if (_tileElementTypes != nullptr)
+    {
+        _tileElementTypes[tilePos.y * kMaximumMapSizeTechnical + tilePos.x].store(0, std::memory_order_relaxed);
+    }
 }
 
 CoordsXY GetMapSizeUnits()
@@ -153,6 +224,8 @@ void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElem
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+    MapInvalidateAllTileContents();
+    MapIncrementTileElementsRevision();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -361,6 +434,44 @@ TileElement* MapGetFirstElementAt(const CoordsXY& elementPos)
     return MapGetFirstElementAt(TileCoordsXY{ elementPos });
 }
 
+TileElementTypeMask MapGetTileElementTypes(const TileCoordsXY& tilePos)
+{
+    if (!IsTileLocationValid(tilePos))
+        return 0;
+
+    const auto* tileElement = _tileIndex.GetFirstElementAt(tilePos);
+    if (tileElement == nullptr)
+        return 0;
+
+    // No map has been set up through SetTileElements yet
+    if (_tileElementTypes == nullptr)
+        return std::numeric_limits<TileElementTypeMask>::max();
+
+    auto& cachedTypes = _tileElementTypes[tilePos.y * kMaximumMapSizeTechnical + tilePos.x];
+    auto types = cachedTypes.load(std::memory_order_relaxed);
+    if (types == 0)
+    {
+        do
+        {
+            types |= TileElementTypeBit(tileElement->GetType());
+        } while (!(tileElement++)->IsLastForTile());
+        cachedTypes.store(types, std::memory_order_relaxed);
+    }
+    return types;
+}
+
+void MapPrefetchTileElements(const TileCoordsXY& tilePos)
+{
+    if (!IsTileLocationValid(tilePos))
+        return;
+
+    const auto* tileElement = _tileIndex.GetFirstElementAt(tilePos);
+    if (tileElement != nullptr)
+    {
+        PREFETCH(tileElement);
+    }
+}
+
 TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n)
 {
     TileElement* tileElement = MapGetFirstElementAt(coords);
@@ -412,6 +523,7 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapInvalidateTileContents(tilePos);
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -747,6 +859,87 @@ bool MapCoordIsConnected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+static MapMaintenanceStats& GetMaintenanceStatsForTick()
+{
+    const auto currentTicks = GetGameState().CurrentTicks;
+    if (_maintenanceStatsTick != currentTicks)
+    {
+        _maintenanceStatsTick = currentTicks;
+        _maintenanceStats = {};
+    }
+    return _maintenanceStats;
+}
+
+/**
+ * Adds the time spent in the enclosing scope to the maintenance stats of the current tick.
+ */
+class MaintenanceTimer
+{
+    MapMaintenanceStats& _stats;
+    std::chrono::high_resolution_clock::time_point _start = std::chrono::high_resolution_clock::now();
+
+public:
+    explicit MaintenanceTimer(MapMaintenanceStats& stats)
+        : _stats(stats)
+    {
+    }
+
+    ~MaintenanceTimer()
+    {
+        const auto elapsed = std::chrono::high_resolution_clock::now() - _start;
+        _stats.ElapsedMicroseconds += static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+};
+
+const MapMaintenanceStats& MapGetMaintenanceStats()
+{
+    return _maintenanceStats;
+}
+
+/**
+ * Returns whether the region holding the given tile may contain a footpath element, scanning it first if it has
+ * been edited since it was last looked at. Regions are only ever downgraded to NoPaths by a scan, so a stale
+ * HasPaths after a path is removed merely costs the sweep a few redundant tile visits.
+ */
+static bool MaintenanceRegionHasPaths(const TileCoordsXY& tilePos, MapMaintenanceStats& stats)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+    {
+        return false;
+    }
+    if (_maintenanceRegions.empty())
+    {
+        _maintenanceRegions.assign(
+            kMaximumMapSizeTechnical * kMaintenanceRegionsPerRow, MaintenanceRegionState::Unknown);
+    }
+
+    auto& state = _maintenanceRegions[tilePos.y * kMaintenanceRegionsPerRow + (tilePos.x >> kMaintenanceRegionShift)];
+    if (state == MaintenanceRegionState::Unknown)
+    {
+        stats.WidePathRegionsScanned++;
+        state = MaintenanceRegionState::NoPaths;
+
+        const auto startX = tilePos.x & ~(kMaintenanceRegionSize - 1);
+        const auto endX = std::min<int32_t>(startX + kMaintenanceRegionSize, kMaximumMapSizeTechnical);
+        for (auto x = startX; x < endX && state == MaintenanceRegionState::NoPaths; x++)
+        {
+            const auto* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, tilePos.y });
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                if (tileElement->GetType() == TileElementType::Path)
+                {
+                    state = MaintenanceRegionState::HasPaths;
+                    break;
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+    return state == MaintenanceRegionState::HasPaths;
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -760,16 +953,39 @@ void MapUpdatePathWideFlags()
         return;
     }
 
+    auto& stats = GetMaintenanceStatsForTick();
+    MaintenanceTimer timer(stats);
+
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
+    // Updating a tile without any footpath on it does nothing, so runs of tiles within a region that holds no
+    // footpath are stepped over in one go. The loop position still advances exactly as if every tile was visited.
     CoordsXY& loopPosition = GetGameState().WidePathTileLoopPosition;
-    for (int32_t i = 0; i < 128; i++)
-    {
-        FootpathUpdatePathWideFlags(loopPosition);
+    int32_t remaining = 128;
+    while (remaining > 0)
+    {
+        const TileCoordsXY tilePos{ loopPosition };
+        const auto regionEndX = std::min<int32_t>(
+            (tilePos.x | (kMaintenanceRegionSize - 1)) + 1, kMaximumMapSizeTechnical);
+        const auto runLength = std::clamp(regionEndX - tilePos.x, 1, remaining);
+        if (MaintenanceRegionHasPaths(tilePos, stats))
+        {
+            for (int32_t i = 0; i < runLength; i++)
+            {
+                FootpathUpdatePathWideFlags(loopPosition);
+                loopPosition.x += kCoordsXYStep;
+            }
+            stats.WidePathTilesUpdated += runLength;
+        }
+        else
+        {
+            loopPosition.x += runLength * kCoordsXYStep;
+            stats.WidePathTilesSkipped += runLength;
+        }
+        remaining -= runLength;
 
         // Next x, y tile
-        loopPosition.x += kCoordsXYStep;
         if (loopPosition.x >= MAXIMUM_MAP_SIZE_BIG)
         {
             loopPosition.x = 0;
@@ -1019,6 +1235,8 @@ bool MapIsLocationAtEdge(const CoordsXY& loc)
  */
 void TileElementRemove(TileElement* tileElement)
 {
+    const bool isGhost = tileElement->IsGhost();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1039,6 +1257,10 @@ void TileElementRemove(TileElement* tileElement)
     {
         gameState.TileElements.pop_back();
     }
+    if (!isGhost)
+    {
+        MapIncrementTileElementsRevision();
+    }
 }
 
 /**
@@ -1187,6 +1409,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapInvalidateTileContents(tileLoc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1258,6 +1481,8 @@ void MapUpdateTiles()
         return;
 
     auto& gameState = GetGameState();
+    auto& stats = GetMaintenanceStatsForTick();
+    MaintenanceTimer timer(stats);
 
     // Update 43 more tiles (for each 256x256 block)
     for (int32_t j = 0; j < 43; j++)
@@ -1288,6 +1513,7 @@ void MapUpdateTiles()
                 {
                     surfaceElement->UpdateGrassLength(mapPos);
                     SceneryUpdateTile(mapPos);
+                    stats.GrassSceneryTiles++;
                 }
             }
         }
@@ -121,6 +121,22 @@ const std::vector<TileElement>& GetTileElements();
 void SetTileElements(OpenRCT2::GameState_t& gameState, std::vector<TileElement>&& tileElements);
 void StashMap();
 void UnstashMap();
+
+/**
+ * Changes whenever the map is replaced, a non-ghost tile element is removed or a game action without the ghost flag is
+ * executed. Results derived from the tile elements must be discarded when this changes. Placing and removing ghosts
+ * leaves it unchanged even though it moves the other elements on the tile, so caches that hold element pointers must
+ * also check that each pointer still refers to the element they found. StashMap gives the temporary map a revision of
+ * its own and UnstashMap restores the revision the map had before, so drawing a preview does not discard them.
+ */
+uint32_t MapGetTileElementsRevision();
+void MapIncrementTileElementsRevision();
+
+/**
+ * Marks the tile as edited outside of TileElementInsert, so that the element type masks and the background map
+ * maintenance re-examine it.
+ */
+void MapInvalidateTileContents(const TileCoordsXY& tilePos);
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
 void MapInit(const TileCoordsXY& size);
@@ -129,6 +145,20 @@ void MapCountRemainingLandRights();
 void MapStripGhostFlagFromElements();
 TileElement* MapGetFirstElementAt(const CoordsXY& tilePos);
 TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos);
+
+/**
+ * Bit set of the element types on a tile, one bit per TileElementType. Computed on first use after the tile was
+ * edited. Removing an element does not clear its bit, so the mask may list types that have gone but never misses one.
+ */
+using TileElementTypeMask = uint16_t;
+
+constexpr TileElementTypeMask TileElementTypeBit(TileElementType type)
+{
+    return static_cast<TileElementTypeMask>(1u << static_cast<uint8_t>(type));
+}
+
+TileElementTypeMask MapGetTileElementTypes(const TileCoordsXY& tilePos);
+void MapPrefetchTileElements(const TileCoordsXY& tilePos);
 TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n);
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type);
 void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements);
@@ -190,7 +220,20 @@ void TileElementIteratorBegin(TileElementIterator* it);
 int32_t TileElementIteratorNext(TileElementIterator* it);
 void TileElementIteratorRestartForTile(TileElementIterator* it);
 
+/**
+ * Work done by the background map maintenance (grass, scenery and path wide flags) during the last game tick.
+ */
+struct MapMaintenanceStats
+{
+    uint32_t GrassSceneryTiles{};
+    uint32_t WidePathTilesUpdated{};
+    uint32_t WidePathTilesSkipped{};
+    uint32_t WidePathRegionsScanned{};
+    uint32_t ElapsedMicroseconds{};
+};
+
 void MapUpdateTiles();
+const MapMaintenanceStats& MapGetMaintenanceStats();
 int32_t MapGetHighestZ(const CoordsXY& loc);
 
 bool TileElementWantsPathConnectionTowards(const TileCoordsXYZD& coords, const TileElement* const elementToBeRemoved);
@@ -30,42 +30,90 @@
 #include "Map.h"
 #include "Scenery.h"
 
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
 using namespace OpenRCT2;
 
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
-static std::vector<MapAnimation> _mapAnimations;
-
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
-static bool InvalidateMapAnimation(const MapAnimation& obj);
+// Animations are bucketed by how often their painted frame can change: every tick, every 2 ticks or every 4 ticks.
+constexpr size_t kNumAnimationPeriods = 3;
+
+/**
+ * The animation period of each type, as a power of two of game ticks. These follow the tick arithmetic of the
+ * matching paint code, e.g. scrolling text advances on (CurrentTicks / 2). Types whose invalidate handler also
+ * updates the tile element, or whose frame depends on the tile position, are invalidated every tick.
+ */
+static constexpr uint8_t kAnimationPeriodShift[MAP_ANIMATION_TYPE_COUNT] = {
+    1, // MAP_ANIMATION_TYPE_RIDE_ENTRANCE
+    1, // MAP_ANIMATION_TYPE_QUEUE_BANNER
+    0, // MAP_ANIMATION_TYPE_SMALL_SCENERY
+    1, // MAP_ANIMATION_TYPE_PARK_ENTRANCE
+    1, // MAP_ANIMATION_TYPE_TRACK_WATERFALL
+    1, // MAP_ANIMATION_TYPE_TRACK_RAPIDS
+    0, // MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO
+    2, // MAP_ANIMATION_TYPE_TRACK_WHIRLPOOL
+    2, // MAP_ANIMATION_TYPE_TRACK_SPINNINGTUNNEL
+    0, // MAP_ANIMATION_TYPE_REMOVE
+    1, // MAP_ANIMATION_TYPE_BANNER
+    1, // MAP_ANIMATION_TYPE_LARGE_SCENERY
+    1, // MAP_ANIMATION_TYPE_WALL_DOOR
+    0, // MAP_ANIMATION_TYPE_WALL
+};
 
-static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
+struct MapAnimationHash
 {
-    for (const auto& a : _mapAnimations)
+    size_t operator()(const MapAnimation& a) const noexcept
     {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
+        auto hash = static_cast<uint64_t>(static_cast<uint16_t>(a.location.x));
+        hash = (hash << 16) | static_cast<uint16_t>(a.location.y);
+        hash = (hash << 16) | static_cast<uint16_t>(a.location.z);
+        hash = (hash << 8) | a.type;
+        return std::hash<uint64_t>{}(hash);
+    }
+};
+
+struct MapAnimationEqual
+{
+    bool operator()(const MapAnimation& lhs, const MapAnimation& rhs) const noexcept
+    {
+        return lhs.type == rhs.type && lhs.location == rhs.location;
     }
-    return false;
+};
+
+// Each bucket keeps its animations in creation order so the invalidate handlers run in a deterministic order.
+static std::array<std::vector<MapAnimation>, kNumAnimationPeriods> _mapAnimationBuckets;
+static std::unordered_set<MapAnimation, MapAnimationHash, MapAnimationEqual> _mapAnimationSet;
+
+static bool InvalidateMapAnimation(const MapAnimation& obj);
+
+static size_t GetAnimationPeriodShift(uint8_t type)
+{
+    return type < std::size(kAnimationPeriodShift) ? kAnimationPeriodShift[type] : 0;
 }
 
 void MapAnimationCreate(int32_t type, const CoordsXYZ& loc)
 {
-    if (!DoesAnimationExist(type, loc))
+    MapAnimation animation{ static_cast<uint8_t>(type), loc };
+    if (_mapAnimationSet.find(animation) != _mapAnimationSet.end())
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
-        {
-            // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
-        }
-        else
-        {
-            LOG_ERROR("Exceeded the maximum number of animations");
-        }
+        // Animation already exists
+        return;
+    }
+
+    if (_mapAnimationSet.size() < MAX_ANIMATED_OBJECTS)
+    {
+        // Create new animation
+        _mapAnimationSet.insert(animation);
+        _mapAnimationBuckets[GetAnimationPeriodShift(animation.type)].push_back(animation);
+    }
+    else
+    {
+        LOG_ERROR("Exceeded the maximum number of animations");
     }
 }
 
@@ -77,18 +125,24 @@ void MapAnimationInvalidateAll()
 {
     PROFILED_FUNCTION();
 
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    const auto currentTicks = GetGameState().CurrentTicks;
+    for (size_t periodShift = 0; periodShift < kNumAnimationPeriods; periodShift++)
     {
-        if (InvalidateMapAnimation(*it))
-        {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
-        }
-        else
-        {
-            it++;
-        }
+        // Nothing in this bucket can have changed its frame since it was last invalidated
+        if (currentTicks & ((1u << periodShift) - 1))
+            continue;
+
+        auto& bucket = _mapAnimationBuckets[periodShift];
+        auto last = std::remove_if(bucket.begin(), bucket.end(), [](const MapAnimation& a) {
+            if (InvalidateMapAnimation(a))
+            {
+                // Map animation has finished, remove it
+                _mapAnimationSet.erase(a);
+                return true;
+            }
+            return false;
+        });
+        bucket.erase(last, bucket.end());
     }
 }
 
@@ -596,14 +650,13 @@ static bool InvalidateMapAnimation(const MapAnimation& a)
     return true;
 }
 
-const std::vector<MapAnimation>& GetMapAnimations()
-{
-    return _mapAnimations;
-}
-
 void ClearMapAnimations()
 {
-    _mapAnimations.clear();
+    for (auto& bucket : _mapAnimationBuckets)
+    {
+        bucket.clear();
+    }
+    _mapAnimationSet.clear();
 }
 
 void MapAnimationAutoCreate()
@@ -716,8 +769,13 @@ void ShiftAllMapAnimations(CoordsXY amount)
     if (amount.x == 0 && amount.y == 0)
         return;
 
-    for (auto& a : _mapAnimations)
+    _mapAnimationSet.clear();
+    for (auto& bucket : _mapAnimationBuckets)
     {
-        a.location += amount;
+        for (auto& a : bucket)
+        {
+            a.location += amount;
+            _mapAnimationSet.insert(a);
+        }
     }
 }
@@ -18,6 +18,7 @@
 #include "../actions/ParkSetParameterAction.h"
 #include "../core/Memory.hpp"
 #include "../core/String.hpp"
+#include "../entity/GuestStatistics.h"
 #include "../entity/Litter.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
@@ -411,22 +412,9 @@ namespace OpenRCT2::Park
             result -= 150 - (std::min<int32_t>(2000, gameState.NumGuestsInPark) / 13);
 
             // Find the number of happy peeps and the number of peeps who can't find the park exit
-            uint32_t happyGuestCount = 0;
-            uint32_t lostGuestCount = 0;
-            for (auto peep : EntityList<Guest>())
-            {
-                if (!peep->OutsideOfPark)
-                {
-                    if (peep->Happiness > 128)
-                    {
-                        happyGuestCount++;
-                    }
-                    if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                    {
-                        lostGuestCount++;
-                    }
-                }
-            }
+            const auto& stats = GuestStatistics::Get();
+            const auto happyGuestCount = stats.HappyGuests;
+            const auto lostGuestCount = stats.LostGuests;
 
             // Peep happiness -500 to +0
             result -= 500;
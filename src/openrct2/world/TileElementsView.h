@@ -118,6 +118,12 @@ namespace OpenRCT2
 
         Iterator begin() noexcept
         {
+            if constexpr (!std::is_same_v<T, TileElement>)
+            {
+                if (!(MapGetTileElementTypes(_loc) & TileElementTypeBit(T::ElementType)))
+                    return end();
+            }
+
             T* element = reinterpret_cast<T*>(MapGetFirstElementAt(_loc));
 
             if constexpr (!std::is_same_v<T, TileElement>)
@@ -134,4 +140,32 @@ namespace OpenRCT2
         }
     };
 
+    /**
+     * Calls func(tilePos, element) for every element of type T on the tiles from min to max inclusive, row by row.
+     * Tiles holding no such element are skipped by their type mask, and the elements of the tiles a few steps ahead
+     * are prefetched while the current one is walked.
+     */
+    template<typename T, typename TFunc>
+    void ForEachTileElementInRange(const TileCoordsXY& min, const TileCoordsXY& max, TFunc&& func)
+    {
+        constexpr int32_t kPrefetchDistance = 4;
+
+        for (int32_t y = min.y; y <= max.y; y++)
+        {
+            for (int32_t x = min.x; x <= max.x; x++)
+            {
+                if (x + kPrefetchDistance <= max.x)
+                {
+                    MapPrefetchTileElements({ x + kPrefetchDistance, y });
+                }
+
+                const TileCoordsXY tilePos{ x, y };
+                for (auto* element : TileElementsView<T>(tilePos))
+                {
+                    func(tilePos, element);
+                }
+            }
+        }
+    }
+
 } // namespace OpenRCT2
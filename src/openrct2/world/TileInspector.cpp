@@ -342,6 +342,7 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            MapInvalidateTileContents(tileLoc);
 
             MapAnimationAutoCreateAtTileElement(tileLoc, pastedElement);
 
@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <openrct2/audio/AudioMixing.h>
+#include <openrct2/platform/Platform.h>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Audio;
+
+using MixFunction = void (*)(float*, const int16_t*, int32_t, const MixRamp&);
+using ResolveFunction = void (*)(int16_t*, const float*, int32_t);
+
+// Odd frame count so the vectorised kernels also exercise their scalar tail.
+constexpr int32_t kTestFrames = 1031;
+
+static std::vector<int16_t> CreateTestSignal(int32_t frames)
+{
+    std::vector<int16_t> samples(frames * 2);
+    uint32_t seed = 0x12345678;
+    for (auto& sample : samples)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        sample = static_cast<int16_t>(seed >> 16);
+    }
+    return samples;
+}
+
+static std::vector<int16_t> MixAndResolve(MixFunction mix, ResolveFunction resolve)
+{
+    const auto first = CreateTestSignal(kTestFrames);
+    const auto second = CreateTestSignal(kTestFrames);
+
+    MixRamp fadeIn;
+    fadeIn.PanL = 0.25f;
+    fadeIn.PanStepL = 0.75f / kTestFrames;
+    fadeIn.Volume = 0.0f;
+    fadeIn.VolumeStep = 1.0f / kTestFrames;
+
+    MixRamp loud;
+    loud.Volume = 1.5f;
+
+    std::vector<float> bus(kTestFrames * 2, 0.0f);
+    mix(bus.data(), first.data(), kTestFrames, fadeIn);
+    mix(bus.data(), second.data(), kTestFrames, loud);
+
+    std::vector<int16_t> result(bus.size());
+    resolve(result.data(), bus.data(), static_cast<int32_t>(bus.size()));
+    return result;
+}
+
+static void AssertMatchesScalar(MixFunction mix, ResolveFunction resolve)
+{
+    const auto expected = MixAndResolve(MixS16StereoScalar, ResolveS16Scalar);
+    const auto actual = MixAndResolve(mix, resolve);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        // Allow for a compiler contracting the scalar kernel into fused multiply-adds.
+        ASSERT_LE(std::abs(expected[i] - actual[i]), 1) << "sample " << i;
+    }
+}
+
+TEST(AudioMixingTest, ScalarAppliesRamp)
+{
+    const std::vector<int16_t> src = { 1000, 1000, 1000, 1000 };
+    std::vector<float> bus(src.size(), 0.0f);
+
+    MixRamp ramp;
+    ramp.PanR = 0.5f;
+    ramp.Volume = 1.0f;
+    ramp.VolumeStep = -0.5f;
+    MixS16StereoScalar(bus.data(), src.data(), 2, ramp);
+
+    ASSERT_FLOAT_EQ(bus[0], 1000.0f);
+    ASSERT_FLOAT_EQ(bus[1], 500.0f);
+    ASSERT_FLOAT_EQ(bus[2], 500.0f);
+    ASSERT_FLOAT_EQ(bus[3], 250.0f);
+}
+
+TEST(AudioMixingTest, ResolveSaturates)
+{
+    const std::vector<float> bus = { 40000.0f, -40000.0f, 123.9f, -123.9f };
+    std::vector<int16_t> result(bus.size());
+    ResolveS16Scalar(result.data(), bus.data(), static_cast<int32_t>(bus.size()));
+
+    ASSERT_EQ(result[0], 32767);
+    ASSERT_EQ(result[1], -32768);
+    ASSERT_EQ(result[2], 123);
+    ASSERT_EQ(result[3], -123);
+}
+
+TEST(AudioMixingTest, Sse4_1MatchesScalar)
+{
+    if (!Platform::SSE41Available())
+    {
+        GTEST_SKIP() << "SSE4.1 is not available on this CPU";
+    }
+    AssertMatchesScalar(MixS16StereoSse4_1, ResolveS16Sse4_1);
+}
+
+TEST(AudioMixingTest, Avx2MatchesScalar)
+{
+    if (!Platform::AVX2Available())
+    {
+        GTEST_SKIP() << "AVX2 is not available on this CPU";
+    }
+    AssertMatchesScalar(MixS16StereoAvx2, ResolveS16Avx2);
+}
@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/MemoryStream.h>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace OpenRCT2;
+
+template<typename T> static std::vector<uint8_t> Encode(const T& value)
+{
+    MemoryStream stream;
+    DataSerialiser ds(true, stream);
+    ds << value;
+    const auto* data = static_cast<const uint8_t*>(stream.GetData());
+    return std::vector<uint8_t>(data, data + stream.GetLength());
+}
+
+// Encodes a length prefix and then every element on its own, as the array traits did before the block path
+template<typename T> static std::vector<uint8_t> EncodePerElement(const T* values, size_t count)
+{
+    MemoryStream stream;
+    DataSerialiser ds(true, stream);
+    ds << static_cast<uint16_t>(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        ds << values[i];
+    }
+    const auto* data = static_cast<const uint8_t*>(stream.GetData());
+    return std::vector<uint8_t>(data, data + stream.GetLength());
+}
+
+template<typename T> static void Decode(const std::vector<uint8_t>& data, T& value)
+{
+    MemoryStream stream(data.data(), data.size());
+    DataSerialiser ds(false, stream);
+    ds << value;
+}
+
+static TileElement CreateTestTileElement(uint8_t seed)
+{
+    TileElement tileElement{};
+    auto* bytes = reinterpret_cast<uint8_t*>(&tileElement);
+    for (size_t i = 0; i < sizeof(TileElement); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(seed + i * 7);
+    }
+    return tileElement;
+}
+
+TEST(DataSerialiserTest, ArraysEncodeSameBytesAsPerElement)
+{
+    // Longer than the swap buffer so that the chunking is covered
+    std::array<uint16_t, 600> words{};
+    for (size_t i = 0; i < words.size(); i++)
+    {
+        words[i] = static_cast<uint16_t>(0x1234 + i * 0x101);
+    }
+    ASSERT_EQ(Encode(words), EncodePerElement(words.data(), words.size()));
+
+    std::array<EntityId, 4> ids = { EntityId::FromUnderlying(1), EntityId::FromUnderlying(0x1234), EntityId::GetNull(),
+                                    EntityId::FromUnderlying(7) };
+    ASSERT_EQ(Encode(ids), EncodePerElement(ids.data(), ids.size()));
+
+    uint32_t dwords[3] = { 0x12345678, 0, 0xFFFFFFFF };
+    ASSERT_EQ(Encode(dwords), EncodePerElement(dwords, std::size(dwords)));
+
+    std::vector<uint8_t> bytes = { 1, 2, 3, 250 };
+    ASSERT_EQ(Encode(bytes), EncodePerElement(bytes.data(), bytes.size()));
+}
+
+TEST(DataSerialiserTest, TileElementEncodesFieldsInOrder)
+{
+    const auto tileElement = CreateTestTileElement(3);
+    const auto data = Encode(tileElement);
+    ASSERT_EQ(data.size(), sizeof(TileElement));
+    ASSERT_EQ(data[0], tileElement.Type);
+    ASSERT_EQ(data[1], tileElement.Flags);
+    ASSERT_EQ(data[2], tileElement.BaseHeight);
+    ASSERT_EQ(data[3], tileElement.ClearanceHeight);
+    ASSERT_EQ(data[4], tileElement.Owner);
+    ASSERT_EQ(data[5], tileElement.Pad05[0]);
+    ASSERT_EQ(data[8], tileElement.Pad08[0]);
+    ASSERT_EQ(data[15], tileElement.Pad08[7]);
+}
+
+TEST(DataSerialiserTest, TileElementVectorRoundTrips)
+{
+    std::vector<TileElement> tileElements;
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        tileElements.push_back(CreateTestTileElement(i));
+    }
+    const auto data = Encode(tileElements);
+    ASSERT_EQ(data, EncodePerElement(tileElements.data(), tileElements.size()));
+
+    // Decoding appends to what is already in the vector
+    std::vector<TileElement> result = { CreateTestTileElement(200) };
+    Decode(data, result);
+    ASSERT_EQ(result.size(), tileElements.size() + 1);
+    const auto first = CreateTestTileElement(200);
+    ASSERT_EQ(std::memcmp(&result[0], &first, sizeof(TileElement)), 0);
+    ASSERT_EQ(std::memcmp(result.data() + 1, tileElements.data(), tileElements.size() * sizeof(TileElement)), 0);
+}
+
+TEST(DataSerialiserTest, SpanRoundTripsLikeArray)
+{
+    std::array<int32_t, 5> values = { -1, 0, 1, 0x12345678, -0x12345678 };
+    const auto data = Encode(std::span<const int32_t>(values));
+    ASSERT_EQ(data, Encode(values));
+
+    std::array<int32_t, 5> result{};
+    Decode(data, result);
+    ASSERT_EQ(result, values);
+
+    std::array<int32_t, 5> spanResult{};
+    auto span = std::span<int32_t>(spanResult);
+    Decode(data, span);
+    ASSERT_EQ(spanResult, values);
+
+    std::array<int32_t, 4> tooShort{};
+    auto tooShortSpan = std::span<int32_t>(tooShort);
+    ASSERT_THROW(Decode(data, tooShortSpan), std::runtime_error);
+}
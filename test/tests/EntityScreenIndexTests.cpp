@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/world/Map.h>
+
+using namespace OpenRCT2;
+
+class EntityScreenIndexTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    void SetUp() override
+    {
+        MapInit({ 32, 32 });
+        ResetAllEntities();
+    }
+
+    static Litter* PlaceLitter(const CoordsXYZ& loc)
+    {
+        auto* litter = CreateEntity<Litter>();
+        litter->SpriteData.Width = 6;
+        litter->SpriteData.HeightMin = 6;
+        litter->SpriteData.HeightMax = 3;
+        litter->MoveTo(loc);
+        return litter;
+    }
+
+    /**
+     * Checks whether the entity is among those the index finds close to where the given location is drawn. The index
+     * works in coarse cells, so the locations in the tests are drawn far apart.
+     */
+    static bool IsOnScreenAt(EntityId id, const CoordsXYZ& loc, uint8_t rotation)
+    {
+        const auto screenCoords = Translate3DTo2DWithZ(rotation, loc);
+        const auto entities = GetEntityScreenList(
+            { screenCoords - ScreenCoordsXY{ 8, 8 }, screenCoords + ScreenCoordsXY{ 8, 8 } }, rotation);
+        return std::find(entities.begin(), entities.end(), id) != entities.end();
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> EntityScreenIndexTests::_context;
+
+TEST_F(EntityScreenIndexTests, every_rotation)
+{
+    const CoordsXYZ loc = { 10 * kCoordsXYStep + 16, 20 * kCoordsXYStep + 16, 14 * kCoordsZStep };
+    const auto id = PlaceLitter(loc)->Id;
+
+    // The litter does not move while the index is rebuilt for each rotation in turn
+    for (uint8_t rotation = 0; rotation < kNumOrthogonalDirections; rotation++)
+    {
+        EXPECT_TRUE(IsOnScreenAt(id, loc, rotation));
+        EXPECT_FALSE(IsOnScreenAt(id, loc + CoordsXYZ{ 0, 0, 1000 }, rotation));
+    }
+    EXPECT_TRUE(IsOnScreenAt(id, loc, 0));
+}
+
+TEST_F(EntityScreenIndexTests, move_after_rotation)
+{
+    const CoordsXYZ oldLoc = { kCoordsXYStep + 16, kCoordsXYStep + 16, 14 * kCoordsZStep };
+    const CoordsXYZ newLoc = { 30 * kCoordsXYStep + 16, 30 * kCoordsXYStep + 16, 14 * kCoordsZStep };
+    auto* litter = PlaceLitter(oldLoc);
+    const auto id = litter->Id;
+    ASSERT_TRUE(IsOnScreenAt(id, oldLoc, 0));
+    ASSERT_TRUE(IsOnScreenAt(id, oldLoc, 1));
+
+    litter->MoveTo(newLoc);
+    EXPECT_TRUE(IsOnScreenAt(id, newLoc, 1));
+    EXPECT_FALSE(IsOnScreenAt(id, oldLoc, 1));
+    EXPECT_TRUE(IsOnScreenAt(id, newLoc, 0));
+    EXPECT_FALSE(IsOnScreenAt(id, oldLoc, 0));
+
+    EntityRemove(litter);
+    EXPECT_FALSE(IsOnScreenAt(id, newLoc, 0));
+}
+
+TEST_F(EntityScreenIndexTests, sprite_size_change)
+{
+    const CoordsXYZ loc = { 16 * kCoordsXYStep + 16, 16 * kCoordsXYStep + 16, 14 * kCoordsZStep };
+    auto* litter = PlaceLitter(loc);
+    const auto id = litter->Id;
+
+    // The sprite grows to the largest extents without moving, and is still found at every corner of its rectangle
+    litter->SpriteData.Width = 255;
+    litter->SpriteData.HeightMin = 255;
+    litter->SpriteData.HeightMax = 255;
+    const auto screenCoords = Translate3DTo2DWithZ(0, loc);
+    for (const auto& corner : { ScreenCoordsXY{ -255, -255 }, ScreenCoordsXY{ 255, -255 }, ScreenCoordsXY{ -255, 255 },
+                                ScreenCoordsXY{ 255, 255 } })
+    {
+        const auto point = screenCoords + corner;
+        const auto entities = GetEntityScreenList({ point, point }, 0);
+        EXPECT_NE(std::find(entities.begin(), entities.end(), id), entities.end());
+    }
+}
@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/peep/FootpathGraph.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/TileElement.h>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::PathFinding;
+
+// Directions out of a tile, -x, +y, +x and -y
+static constexpr Direction kWest = 0;
+static constexpr Direction kSouth = 1;
+static constexpr Direction kEast = 2;
+static constexpr Direction kNorth = 3;
+static constexpr uint8_t kAllDirections = 0b1111;
+static constexpr int32_t kPathHeight = 14;
+
+class FootpathGraphTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    void SetUp() override
+    {
+        MapInit({ 32, 32 });
+    }
+
+    static PathElement* PlacePath(const TileCoordsXY& loc, uint8_t edges, bool isGhost = false)
+    {
+        auto* pathElement = TileElementInsert<PathElement>({ loc.ToCoordsXY(), kPathHeight * kCoordsZStep }, 0b1111);
+        pathElement->SetClearanceZ((kPathHeight + 4) * kCoordsZStep);
+        pathElement->SetEdges(edges);
+        pathElement->SetGhost(isGhost);
+        return pathElement;
+    }
+
+    static PathElement* PlaceQueue(const TileCoordsXY& loc, uint8_t edges, RideId rideIndex)
+    {
+        auto* pathElement = PlacePath(loc, edges);
+        pathElement->SetIsQueue(true);
+        pathElement->SetRideIndex(rideIndex);
+        return pathElement;
+    }
+
+    /**
+     * Places a square loop of paths from (2, 5) to (6, 8), whose top side between (3, 5) and (5, 5) is the short way
+     * from one top corner to the other.
+     */
+    static void PlaceLoop(bool topIsQueue)
+    {
+        PlacePath({ 2, 5 }, 0b0110);
+        for (int32_t x = 3; x <= 5; x++)
+        {
+            if (topIsQueue)
+                PlaceQueue({ x, 5 }, 0b0101, RideId::FromUnderlying(0));
+            else
+                PlacePath({ x, 5 }, 0b0101);
+        }
+        PlacePath({ 6, 5 }, 0b0011);
+        for (int32_t y = 6; y <= 7; y++)
+        {
+            PlacePath({ 2, y }, 0b1010);
+            PlacePath({ 6, y }, 0b1010);
+        }
+        PlacePath({ 2, 8 }, 0b1100);
+        for (int32_t x = 3; x <= 5; x++)
+            PlacePath({ x, 8 }, 0b0101);
+        PlacePath({ 6, 8 }, 0b1001);
+    }
+
+    /**
+     * Marks the paths placed directly as changed, as a game action would.
+     */
+    static void CommitPaths()
+    {
+        MapIncrementTileElementsRevision();
+    }
+
+    static Direction Choose(
+        const TileCoordsXY& loc, const TileCoordsXY& goal, RideId queueRideIndex = RideId::GetNull(),
+        bool ignoreForeignQueues = false)
+    {
+        return ChooseFootpathGraphDirection(
+            { loc, kPathHeight }, { goal, kPathHeight }, kAllDirections, queueRideIndex, ignoreForeignQueues);
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> FootpathGraphTests::_context;
+
+TEST_F(FootpathGraphTests, junction)
+{
+    // A row of paths from (2, 5) to (10, 5) with a branch from (6, 5) down to (6, 10)
+    PlacePath({ 2, 5 }, 0b0100);
+    for (int32_t x = 3; x <= 9; x++)
+        PlacePath({ x, 5 }, x == 6 ? 0b0111 : 0b0101);
+    PlacePath({ 10, 5 }, 0b0001);
+    for (int32_t y = 6; y <= 9; y++)
+        PlacePath({ 6, y }, 0b1010);
+    PlacePath({ 6, 10 }, 0b1000);
+    CommitPaths();
+
+    EXPECT_EQ(Choose({ 6, 5 }, { 6, 10 }), kSouth);
+    EXPECT_EQ(Choose({ 6, 5 }, { 10, 5 }), kEast);
+    EXPECT_EQ(Choose({ 6, 5 }, { 2, 5 }), kWest);
+
+    // Along the corridors either side of the junction
+    EXPECT_EQ(Choose({ 4, 5 }, { 6, 10 }), kEast);
+    EXPECT_EQ(Choose({ 8, 5 }, { 2, 5 }), kWest);
+    EXPECT_EQ(Choose({ 6, 8 }, { 10, 5 }), kNorth);
+
+    // Only the allowed directions are taken, even when it means turning back at a dead end, and there is no direction
+    // to a goal off the paths
+    EXPECT_EQ(
+        ChooseFootpathGraphDirection(
+            { 6, 5, kPathHeight }, { 10, 5, kPathHeight }, 0b0011, RideId::GetNull(), false),
+        kWest);
+    EXPECT_EQ(
+        ChooseFootpathGraphDirection(
+            { 6, 5, kPathHeight }, { 20, 20, kPathHeight }, kAllDirections, RideId::GetNull(), false),
+        INVALID_DIRECTION);
+}
+
+TEST_F(FootpathGraphTests, loop)
+{
+    PlaceLoop(false);
+    CommitPaths();
+
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), kEast);
+    EXPECT_EQ(Choose({ 2, 5 }, { 2, 8 }), kSouth);
+    EXPECT_EQ(Choose({ 4, 8 }, { 6, 5 }), kEast);
+}
+
+TEST_F(FootpathGraphTests, foreign_queue)
+{
+    PlaceLoop(true);
+    CommitPaths();
+
+    // Queues are walked through like any other path unless the guest is told to keep out of other rides' queues
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), kEast);
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }, RideId::GetNull(), true), kSouth);
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }, RideId::FromUnderlying(1), true), kSouth);
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }, RideId::FromUnderlying(0), true), kEast);
+}
+
+TEST_F(FootpathGraphTests, rebuild_after_path_edit)
+{
+    PlaceLoop(false);
+    CommitPaths();
+    ASSERT_EQ(Choose({ 2, 5 }, { 6, 5 }), kEast);
+
+    // Removing a path is a change to the map, so the next query already goes the long way round
+    auto* pathElement = MapGetPathElementAt({ 4, 5, kPathHeight });
+    ASSERT_NE(pathElement, nullptr);
+    TileElementRemove(reinterpret_cast<TileElement*>(pathElement));
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), kSouth);
+}
+
+TEST_F(FootpathGraphTests, ghosts_ignored)
+{
+    // A corridor with a gap at (4, 5), which a ghost path fills
+    PlacePath({ 2, 5 }, 0b0100);
+    PlacePath({ 3, 5 }, 0b0101);
+    PlacePath({ 5, 5 }, 0b0101);
+    PlacePath({ 6, 5 }, 0b0001);
+    CommitPaths();
+    ASSERT_EQ(Choose({ 2, 5 }, { 6, 5 }), INVALID_DIRECTION);
+
+    PlacePath({ 4, 5 }, 0b0101, true);
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), INVALID_DIRECTION);
+
+    // Not even a rebuild for another reason takes the ghost into account
+    CommitPaths();
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), INVALID_DIRECTION);
+
+    PlacePath({ 4, 5 }, 0b0101);
+    CommitPaths();
+    EXPECT_EQ(Choose({ 2, 5 }, { 6, 5 }), kEast);
+}
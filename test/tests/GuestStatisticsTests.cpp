@@ -0,0 +1,158 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/entity/GuestStatistics.h>
+#include <openrct2/world/Map.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class GuestStatisticsTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    void SetUp() override
+    {
+        MapInit({ 32, 32 });
+        ResetAllEntities();
+    }
+
+    static std::vector<Guest*> SpawnGuests(int32_t count)
+    {
+        std::vector<Guest*> guests;
+        for (int32_t i = 0; i < count; i++)
+        {
+            auto* guest = Guest::Generate({ (4 + i % 8) * kCoordsXYStep + 16, 8 * kCoordsXYStep + 16, 14 * kCoordsZStep });
+            if (guest != nullptr)
+            {
+                guests.push_back(guest);
+            }
+        }
+        return guests;
+    }
+
+    /**
+     * Changes the guest the way its own update would and lets the statistics know, as PeepUpdateAll does.
+     */
+    template<typename TFunc> static void ChangeGuest(Guest& guest, TFunc&& func)
+    {
+        func(guest);
+        GuestStatistics::UpdateGuest(guest);
+    }
+
+    static void EnterPark(Guest& guest)
+    {
+        ChangeGuest(guest, [](Guest& g) { g.OutsideOfPark = false; });
+        IncrementGuestsInPark();
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> GuestStatisticsTests::_context;
+
+TEST_F(GuestStatisticsTests, matches_recount)
+{
+    // Count the empty park first so everything after is only known to the statistics through their updates
+    ASSERT_EQ(GuestStatistics::Get().GuestsInPark, 0u);
+
+    auto guests = SpawnGuests(40);
+    ASSERT_EQ(guests.size(), 40u);
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GuestsInPark, 0u);
+
+    // Half of the guests walk into the park, and some of them are happy
+    for (size_t i = 0; i < guests.size(); i += 2)
+    {
+        EnterPark(*guests[i]);
+        ChangeGuest(*guests[i], [i](Guest& guest) { guest.Happiness = i % 4 == 0 ? 200 : 100; });
+    }
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GuestsInPark, 20u);
+    EXPECT_EQ(GuestStatistics::Get().HappyGuests, 10u);
+
+    // Fresh thoughts are counted by type until the guest has something else on their mind
+    guests[0]->InsertNewThought(PeepThoughtType::Hungry);
+    guests[2]->InsertNewThought(PeepThoughtType::Hungry);
+    guests[4]->InsertNewThought(PeepThoughtType::Toilet);
+    guests[1]->InsertNewThought(PeepThoughtType::Hungry);
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Hungry), 2u);
+    EXPECT_EQ(GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Toilet), 1u);
+
+    guests[2]->InsertNewThought(PeepThoughtType::Vandalism);
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Hungry, PeepThoughtType::Vandalism), 2u);
+
+    // A guest that cannot find the exit for long enough counts as lost
+    ChangeGuest(*guests[6], [](Guest& guest) {
+        guest.PeepFlags |= PEEP_FLAGS_LEAVING_PARK;
+        guest.GuestIsLostCountdown = 200;
+    });
+    EXPECT_EQ(GuestStatistics::Get().LostGuests, 0u);
+    ChangeGuest(*guests[6], [](Guest& guest) { guest.GuestIsLostCountdown = 50; });
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().LostGuests, 1u);
+
+    // Guests leave the park, some of them for good
+    ChangeGuest(*guests[8], [](Guest& guest) { guest.OutsideOfPark = true; });
+    DecrementGuestsInPark();
+    guests[0]->Remove();
+    guests[6]->Remove();
+    guests[1]->Remove();
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GuestsInPark, 17u);
+    EXPECT_EQ(GuestStatistics::Get().LostGuests, 0u);
+    EXPECT_EQ(GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Hungry), 0u);
+
+    // New guests keep being counted alongside the ones already there
+    auto newGuests = SpawnGuests(5);
+    for (auto* guest : newGuests)
+    {
+        EnterPark(*guest);
+        guest->InsertNewThought(PeepThoughtType::Toilet);
+    }
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GuestsInPark, 22u);
+    EXPECT_EQ(GuestStatistics::Get().GetFreshThoughtCount(PeepThoughtType::Toilet), 6u);
+}
+
+TEST_F(GuestStatisticsTests, rebuilt_after_reset)
+{
+    auto guests = SpawnGuests(10);
+    for (auto* guest : guests)
+    {
+        EnterPark(*guest);
+    }
+    ASSERT_EQ(GuestStatistics::Get().GuestsInPark, 10u);
+
+    ResetAllEntities();
+    EXPECT_EQ(GuestStatistics::Get(), GuestStatistics::Calculate());
+    EXPECT_EQ(GuestStatistics::Get().GuestsInPark, 0u);
+}
@@ -9,10 +9,14 @@
 
 #include "TestData.h"
 
+#include <array>
 #include <gtest/gtest.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/drawing/ImageImporter.h>
+#include <openrct2/platform/Platform.h>
+#include <sstream>
 #include <string_view>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -34,8 +38,84 @@ public:
         }
         return hash;
     }
+
+    // Searches the whole palette, the way every pixel was matched before the lookup cube
+    static uint8_t GetReferencePaletteIndex(int32_t r, int32_t g, int32_t b)
+    {
+        for (size_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            if (StandardPalette[i].Red == r && StandardPalette[i].Green == g && StandardPalette[i].Blue == b)
+            {
+                return static_cast<uint8_t>(i);
+            }
+        }
+
+        int32_t smallestError = -1;
+        uint8_t bestMatch = 0;
+        for (size_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            // Skip the special and primary remap colours
+            if (i <= 9 || (i >= 230 && i <= 239) || i >= 243)
+                continue;
+
+            const auto dr = StandardPalette[i].Red - r;
+            const auto dg = StandardPalette[i].Green - g;
+            const auto db = StandardPalette[i].Blue - b;
+            const auto error = dr * dr + dg * dg + db * db;
+            if (smallestError == -1 || error < smallestError)
+            {
+                smallestError = error;
+                bestMatch = static_cast<uint8_t>(i);
+            }
+        }
+        return bestMatch;
+    }
+
+    static Image CreateImage(uint32_t width, uint32_t height)
+    {
+        Image image;
+        image.Width = width;
+        image.Height = height;
+        image.Depth = 32;
+        image.Stride = width * 4;
+        image.Pixels.resize(image.Stride * height);
+        return image;
+    }
 };
 
+using FindClosestColourFunction = int32_t (*)(
+    const int32_t*, const int32_t*, const int32_t*, int32_t, int32_t, int32_t, int32_t);
+
+static void AssertMatchesScalar(FindClosestColourFunction actual)
+{
+    // Few distinct values, so that many colours tie and the first one has to be picked
+    uint32_t seed = 0x1234;
+    std::array<int32_t, 64> red;
+    std::array<int32_t, 64> green;
+    std::array<int32_t, 64> blue;
+    for (size_t i = 0; i < red.size(); i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        red[i] = ((seed >> 8) & 3) * 85;
+        green[i] = ((seed >> 12) & 3) * 85;
+        blue[i] = ((seed >> 16) & 3) * 85;
+    }
+
+    for (int32_t count = 0; count <= static_cast<int32_t>(red.size()); count++)
+    {
+        for (int32_t colour = 0; colour < 64; colour++)
+        {
+            // Includes colours outside of 0 to 255, as produced by dithering
+            const auto r = (colour & 3) * 100 - 20;
+            const auto g = ((colour >> 2) & 3) * 90;
+            const auto b = ((colour >> 4) & 3) * 95 - 10;
+            const auto expected = Drawing::FindClosestColourScalar(red.data(), green.data(), blue.data(), count, r, g, b);
+            ASSERT_EQ(expected, actual(red.data(), green.data(), blue.data(), count, r, g, b))
+                << "count " << count << ", colour " << r << " " << g << " " << b;
+        }
+    }
+}
+
 TEST_F(ImageImporterTests, Import_Logo)
 {
     auto logoPath = GetImagePath("logo.png");
@@ -58,3 +138,93 @@ TEST_F(ImageImporterTests, Import_Logo)
     auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
     ASSERT_EQ(uint32_t(0x212A99BC), hash);
 }
+
+TEST_F(ImageImporterTests, Import_Closest_MatchesFullPaletteSearch)
+{
+    // Every green and blue value for a few red values, including the colours of the palette itself
+    auto image = CreateImage(256, 256);
+    for (int32_t r : { 0, 39, 128, 211, 255 })
+    {
+        for (int32_t g = 0; g < 256; g++)
+        {
+            for (int32_t b = 0; b < 256; b++)
+            {
+                auto* pixel = image.Pixels.data() + g * image.Stride + b * 4;
+                pixel[0] = r;
+                pixel[1] = g;
+                pixel[2] = b;
+                pixel[3] = 255;
+            }
+        }
+
+        ImageImporter importer;
+        auto meta = ImageImportMeta{ .importFlags = 0, .importMode = ImportMode::Closest };
+        auto result = importer.Import(image, meta);
+        ASSERT_EQ(result.Buffer.size(), 256u * 256u);
+        for (int32_t g = 0; g < 256; g++)
+        {
+            for (int32_t b = 0; b < 256; b++)
+            {
+                ASSERT_EQ(GetReferencePaletteIndex(r, g, b), result.Buffer[g * 256 + b])
+                    << "colour " << r << " " << g << " " << b;
+            }
+        }
+    }
+}
+
+TEST_F(ImageImporterTests, Png_RoundTrip)
+{
+    constexpr uint32_t kWidth = 37;
+    constexpr uint32_t kHeight = 23;
+    std::vector<uint8_t> indices(kWidth * kHeight);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    std::ostringstream stream;
+    Imaging::PngWriter writer(stream, kWidth, kHeight, 8, &StandardPalette);
+    writer.WriteRows(indices.data(), kWidth, kHeight);
+    writer.Finish();
+    const auto encoded = stream.str();
+    const std::vector<uint8_t> data(encoded.begin(), encoded.end());
+
+    auto paletted = Imaging::ReadFromBuffer(data, IMAGE_FORMAT::PNG);
+    ASSERT_EQ(kWidth, paletted.Width);
+    ASSERT_EQ(kHeight, paletted.Height);
+    ASSERT_EQ(8u, paletted.Depth);
+    ASSERT_EQ(kWidth, paletted.Stride);
+    ASSERT_EQ(indices, paletted.Pixels);
+
+    // Index 0 is written as transparent
+    auto rgba = Imaging::ReadFromBuffer(data, IMAGE_FORMAT::PNG_32);
+    ASSERT_EQ(32u, rgba.Depth);
+    ASSERT_EQ(kWidth * 4, rgba.Stride);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        const auto& colour = StandardPalette[indices[i]];
+        const auto* pixel = rgba.Pixels.data() + i * 4;
+        ASSERT_EQ(colour.Red, pixel[0]);
+        ASSERT_EQ(colour.Green, pixel[1]);
+        ASSERT_EQ(colour.Blue, pixel[2]);
+        ASSERT_EQ(indices[i] == 0 ? 0 : 255, pixel[3]);
+    }
+}
+
+TEST_F(ImageImporterTests, FindClosestColourSse4_1MatchesScalar)
+{
+    if (!Platform::SSE41Available())
+    {
+        GTEST_SKIP() << "SSE4.1 is not available on this CPU";
+    }
+    AssertMatchesScalar(Drawing::FindClosestColourSse4_1);
+}
+
+TEST_F(ImageImporterTests, FindClosestColourAvx2MatchesScalar)
+{
+    if (!Platform::AVX2Available())
+    {
+        GTEST_SKIP() << "AVX2 is not available on this CPU";
+    }
+    AssertMatchesScalar(Drawing::FindClosestColourAvx2);
+}
@@ -66,6 +66,27 @@ TEST_F(LanguagePackTest, language_pack_multibyte)
     ASSERT_STREQ(lang->GetString(0x7002), u8"在隱藏於森林深處的清空範圍中, 建造一個很受歡迎的樂園");
 }
 
+TEST_F(LanguagePackTest, language_pack_compiled)
+{
+    auto data = LanguagePackFactory::Compile(0, LanguageEnGB);
+    auto lang = LanguagePackFactory::FromCompiled(0, data);
+    ASSERT_NE(lang, nullptr);
+    ASSERT_EQ(lang->GetId(), 0);
+    ASSERT_EQ(lang->GetCount(), 4u);
+    ASSERT_EQ(lang->GetString(0), nullptr);
+    ASSERT_STREQ(lang->GetString(1), "{STRINGID} {COMMA16}");
+    ASSERT_STREQ(lang->GetString(2), "Spiral Roller Coaster");
+    ASSERT_EQ(lang->GetScenarioOverrideStringId("Arid Heights", 1), 0x7001);
+    ASSERT_STREQ(lang->GetString(0x7001), "Arid Heights park string");
+    ASSERT_EQ(lang->GetString(1000), nullptr);
+    ASSERT_EQ(lang->GetScenarioOverrideStringId("No such park", 0), STR_NONE);
+
+    // Compiled for another language or cut short
+    ASSERT_EQ(LanguagePackFactory::FromCompiled(1, data), nullptr);
+    data.pop_back();
+    ASSERT_EQ(LanguagePackFactory::FromCompiled(0, data), nullptr);
+}
+
 const utf8* LanguagePackTest::LanguageEnGB = "# STR_XXXX part is read and XXXX becomes the string id number.\n"
                                              "# Everything after the colon and before the new line will be saved as the "
                                              "string.\n"
@@ -11,6 +11,8 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <utility>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -179,6 +181,40 @@ TEST_F(SawyerCodingTest, empty)
     EXPECT_THROW(ptr = reader.ReadChunk(), IOException);
 }
 
+TEST_F(SawyerCodingTest, read_chunks_all_encodings)
+{
+    std::vector<uint8_t> data;
+    for (const auto& [chunk, size] : { std::pair{ nonedata, sizeof(nonedata) }, std::pair{ rledata, sizeof(rledata) },
+                                       std::pair{ rlecompresseddata, sizeof(rlecompresseddata) },
+                                       std::pair{ rotatedata, sizeof(rotatedata) } })
+    {
+        data.insert(data.end(), chunk, chunk + size);
+    }
+
+    OpenRCT2::MemoryStream ms(data.data(), data.size());
+    SawyerChunkReader reader(&ms);
+    auto chunks = reader.ReadChunks(4);
+    ASSERT_EQ(chunks.size(), 4u);
+    for (const auto& chunk : chunks)
+    {
+        ASSERT_EQ(chunk->GetLength(), sizeof(randomdata));
+        ASSERT_EQ(memcmp(chunk->GetData(), randomdata, sizeof(randomdata)), 0);
+    }
+    ASSERT_EQ(ms.GetPosition(), data.size());
+}
+
+TEST_F(SawyerCodingTest, read_chunks_invalid_rewinds)
+{
+    std::vector<uint8_t> data(rledata, rledata + sizeof(rledata));
+    data.insert(data.end(), invalid1, invalid1 + sizeof(invalid1));
+
+    OpenRCT2::MemoryStream ms(data.data(), data.size());
+    SawyerChunkReader reader(&ms);
+    std::vector<std::shared_ptr<SawyerChunk>> chunks;
+    EXPECT_THROW(chunks = reader.ReadChunks(2), SawyerChunkException);
+    ASSERT_EQ(ms.GetPosition(), 0u);
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {
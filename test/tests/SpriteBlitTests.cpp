@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/platform/Platform.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+using BlitRowFunction = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t);
+using BlitRowLutFunction = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t, const uint8_t*);
+
+// Covers empty rows, rows shorter than a vector and odd lengths that leave a scalar tail.
+static constexpr std::array kTestLengths = { 0, 1, 15, 16, 31, 32, 33, 64, 100, 255, 513 };
+
+static std::vector<uint8_t> CreateTestPixels(size_t length, uint32_t seed)
+{
+    std::vector<uint8_t> pixels(length);
+    for (auto& pixel : pixels)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        // Roughly a quarter of the pixels are transparent
+        pixel = (seed >> 30) == 0 ? 0 : static_cast<uint8_t>(seed >> 16);
+    }
+    return pixels;
+}
+
+static std::array<uint8_t, 256> CreateTestLookupTable()
+{
+    std::array<uint8_t, 256> lut{};
+    for (size_t i = 0; i < lut.size(); i++)
+    {
+        // Some entries remap to 0, which must leave the destination untouched
+        lut[i] = (i % 7) == 0 ? 0 : static_cast<uint8_t>(255 - i);
+    }
+    return lut;
+}
+
+template<typename TBlit> static void AssertMatchesScalar(TBlit scalar, TBlit actual)
+{
+    const auto lut = CreateTestLookupTable();
+    for (int32_t srcShift = 0; srcShift <= 3; srcShift++)
+    {
+        for (auto length : kTestLengths)
+        {
+            const auto src = CreateTestPixels(length, 0x1234 + length);
+            const auto dstLength = (length >> srcShift) + 1;
+            auto expected = CreateTestPixels(dstLength, 0x5678 + length);
+            auto result = expected;
+
+            if constexpr (std::is_same_v<TBlit, BlitRowLutFunction>)
+            {
+                scalar(src.data(), expected.data(), length, srcShift, lut.data());
+                actual(src.data(), result.data(), length, srcShift, lut.data());
+            }
+            else
+            {
+                scalar(src.data(), expected.data(), length, srcShift);
+                actual(src.data(), result.data(), length, srcShift);
+            }
+            ASSERT_EQ(expected, result) << "length " << length << ", shift " << srcShift;
+        }
+    }
+}
+
+TEST(SpriteBlitTest, ScalarSkipsTransparentPixels)
+{
+    const std::vector<uint8_t> src = { 10, 0, 20, 0, 0, 30 };
+    std::vector<uint8_t> dst = { 1, 2, 3, 4, 5, 6 };
+    BlitRowTransparentScalar(src.data(), dst.data(), static_cast<int32_t>(src.size()), 0);
+    ASSERT_EQ(dst, (std::vector<uint8_t>{ 10, 2, 20, 4, 5, 30 }));
+
+    // Zoomed out by one level only every other source pixel is drawn
+    dst = { 1, 2, 3, 4, 5, 6 };
+    BlitRowTransparentScalar(src.data(), dst.data(), static_cast<int32_t>(src.size()), 1);
+    ASSERT_EQ(dst, (std::vector<uint8_t>{ 10, 20, 3, 4, 5, 6 }));
+}
+
+TEST(SpriteBlitTest, ScalarRemapsThroughLookupTable)
+{
+    const auto lut = CreateTestLookupTable();
+    const std::vector<uint8_t> src = { 1, 0, 7, 2 };
+    std::vector<uint8_t> dst = { 9, 9, 9, 9 };
+    BlitRowRemapScalar(src.data(), dst.data(), static_cast<int32_t>(src.size()), 0, lut.data());
+    ASSERT_EQ(dst, (std::vector<uint8_t>{ 254, 9, 9, 253 }));
+
+    dst = { 1, 7, 2, 3 };
+    BlitRowRemapDstScalar(src.data(), dst.data(), static_cast<int32_t>(src.size()), 0, lut.data());
+    ASSERT_EQ(dst, (std::vector<uint8_t>{ 254, 7, 253, 252 }));
+}
+
+TEST(SpriteBlitTest, Sse4_1MatchesScalar)
+{
+    if (!Platform::SSE41Available())
+    {
+        GTEST_SKIP() << "SSE4.1 is not available on this CPU";
+    }
+    AssertMatchesScalar<BlitRowFunction>(BlitRowTransparentScalar, BlitRowTransparentSse4_1);
+    AssertMatchesScalar<BlitRowLutFunction>(BlitRowRemapScalar, BlitRowRemapSse4_1);
+    AssertMatchesScalar<BlitRowLutFunction>(BlitRowRemapDstScalar, BlitRowRemapDstSse4_1);
+}
+
+TEST(SpriteBlitTest, Avx2MatchesScalar)
+{
+    if (!Platform::AVX2Available())
+    {
+        GTEST_SKIP() << "AVX2 is not available on this CPU";
+    }
+    AssertMatchesScalar<BlitRowFunction>(BlitRowTransparentScalar, BlitRowTransparentAvx2);
+    AssertMatchesScalar<BlitRowLutFunction>(BlitRowRemapScalar, BlitRowRemapAvx2);
+    AssertMatchesScalar<BlitRowLutFunction>(BlitRowRemapDstScalar, BlitRowRemapDstAvx2);
+}
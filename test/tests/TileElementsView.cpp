@@ -179,3 +179,45 @@ TEST_F(TileElementsViewTests, QueryTypeBannerElements)
 {
     CheckMapTiles<BannerElement>();
 }
+
+TEST_F(TileElementsViewTests, QueryRangeMatchesViews)
+{
+    const TileCoordsXY min{ 20, 20 };
+    const TileCoordsXY max{ 99, 79 };
+
+    std::vector<PathElement*> expected;
+    for (int32_t y = min.y; y <= max.y; y++)
+    {
+        for (int32_t x = min.x; x <= max.x; x++)
+        {
+            auto list = BuildListManual<PathElement>(TileCoordsXY(x, y).ToCoordsXY());
+            expected.insert(expected.end(), list.begin(), list.end());
+        }
+    }
+
+    std::vector<PathElement*> visited;
+    ForEachTileElementInRange<PathElement>(min, max, [&visited](const TileCoordsXY&, PathElement* pathElement) {
+        visited.push_back(pathElement);
+    });
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, visited);
+}
+
+TEST_F(TileElementsViewTests, QueryTypeSeesInsertedElement)
+{
+    // Find a tile without any track, look at it so that its type mask is filled in, then put a track piece on it
+    TileCoordsXY tilePos{ 1, 1 };
+    while (!BuildListManual<TrackElement>(tilePos.ToCoordsXY()).empty())
+    {
+        tilePos.x++;
+    }
+    ASSERT_TRUE(BuildListByView<TrackElement>(tilePos.ToCoordsXY()).empty());
+
+    auto* trackElement = TileElementInsert<TrackElement>({ tilePos.ToCoordsXY(), 200 * kCoordsZStep }, 0b1111);
+    ASSERT_NE(trackElement, nullptr);
+    ASSERT_TRUE(CompareLists<TrackElement>(tilePos.ToCoordsXY()));
+    ASSERT_EQ(BuildListByView<TrackElement>(tilePos.ToCoordsXY()).size(), 1u);
+
+    TileElementRemove(reinterpret_cast<TileElement*>(trackElement));
+    ASSERT_TRUE(BuildListByView<TrackElement>(tilePos.ToCoordsXY()).empty());
+}